@@ -0,0 +1,232 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compact.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:41:19 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:03 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#define ENTRIES		2000000
+#define LOOKUPS		1000000
+#define SCANS		10
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Value whose copy throws once copies_left reaches zero */
+struct	fragile
+{
+	static int	copies_left;
+	int			value;
+
+	fragile(int v) : value(v) {};
+	fragile(const fragile& other) : value(other.value)
+	{
+		if (copies_left == 0)
+			throw std::runtime_error("fragile: copy failed");
+		if (copies_left > 0)
+			copies_left--;
+	};
+	fragile&	operator=(const fragile& other)
+	{
+		this->value = other.value;
+		return (*this);
+	};
+	bool	operator<(const fragile& other) const { return (this->value < other.value); };
+};
+
+int	fragile::copies_left = -1;
+
+template <class Key, class T>
+void	map_check(ft::map<Key, T> const &ft_m, std::map<Key, T> const &std_m)
+{
+	assert(ft_m.size() == std_m.size());
+	typename std::map<Key, T>::const_iterator	std_it = std_m.begin();
+	for (typename ft::map<Key, T>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it, ++std_it)
+		assert(it->first == std_it->first && it->second == std_it->second);
+	typename std::map<Key, T>::const_reverse_iterator	std_rit = std_m.rbegin();
+	for (typename ft::map<Key, T>::const_reverse_iterator it = ft_m.rbegin(); it != ft_m.rend(); ++it, ++std_rit)
+		assert(it->first == std_rit->first);
+	for (typename std::map<Key, T>::const_iterator it = std_m.begin(); it != std_m.end(); ++it)
+		assert(ft_m.find(it->first)->second == it->second);
+}
+
+/* Checks that the elements sit at one fixed stride in key order, as in a compacted tree */
+template <class Container>
+bool	is_contiguous(Container const &ft_c)
+{
+	typename Container::const_iterator	it = ft_c.begin();
+	typename Container::const_iterator	next = it;
+
+	if (ft_c.size() < 2)
+		return (true);
+	const std::ptrdiff_t	stride = reinterpret_cast<const char *>(&*++next) - reinterpret_cast<const char *>(&*it);
+	for (; next != ft_c.end(); ++it, ++next)
+		if (reinterpret_cast<const char *>(&*next) - reinterpret_cast<const char *>(&*it) != stride)
+			return (false);
+	return (stride > 0);
+}
+
+int	main(void)
+{
+	{
+		print_break("Map");
+		ft::map<int, std::string>	ft_m;
+		std::map<int, std::string>	std_m;
+		ft_m.compact();
+		assert(ft_m.empty());
+		srand(42);
+		for (int round = 0; round < 30; round++)
+		{
+			for (int i = 0; i < 300; i++)
+			{
+				int	key = rand() % 2000;
+				ft_m[key] = std::string(key % 9 + 1, 'a' + key % 26);
+				std_m[key] = std::string(key % 9 + 1, 'a' + key % 26);
+			}
+			for (int i = 0; i < 200; i++)
+			{
+				int	key = rand() % 2000;
+				ft_m.erase(key);
+				std_m.erase(key);
+			}
+			if (round % 3 == 0)
+			{
+				ft_m.compact();
+				assert(is_contiguous(ft_m));
+			}
+			map_check(ft_m, std_m);
+		}
+		ft_m.compact();
+		assert(is_contiguous(ft_m));
+		ft::map<int, std::string>	ft_copy(ft_m);
+		ft::map<int, std::string>	ft_other;
+		ft_other[-1] = "minus one";
+		ft_other.compact();
+		ft_other.swap(ft_m);
+		map_check(ft_other, std_m);
+		map_check(ft_copy, std_m);
+		assert(ft_m.size() == 1 && ft_m.begin()->second == "minus one");
+		ft_m.erase(-1);
+		assert(ft_m.empty());
+		ft_m[3] = "three";
+		assert(ft_m.size() == 1);
+		while (ft_other.empty() == false)
+			ft_other.erase(ft_other.begin());
+		ft_other.insert(ft::make_pair(1, std::string("one")));
+		ft_other.clear();
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		ft::set<int>	ft_s;
+		std::set<int>	std_s;
+		for (int n = 0; n < 70; n++)
+		{
+			ft_s.insert(n * 5);
+			std_s.insert(n * 5);
+			ft_s.compact();
+			assert(is_contiguous(ft_s));
+			assert(ft::equal(ft_s.begin(), ft_s.end(), std_s.begin()));
+			for (int key = -1; key <= n * 5 + 1; key++)
+				assert(ft_s.count(key) == std_s.count(key) && (ft_s.lower_bound(key) == ft_s.end()) == (std_s.lower_bound(key) == std_s.end()));
+		}
+		for (int i = 0; i < 35; i++)
+		{
+			ft_s.erase(i * 10);
+			std_s.erase(i * 10);
+			ft_s.insert(i * 10 + 1);
+			std_s.insert(i * 10 + 1);
+		}
+		assert(ft::equal(ft_s.begin(), ft_s.end(), std_s.begin()));
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Exception safety");
+		ft::set<fragile>	ft_s;
+		for (int i = 0; i < 100; i++)
+			ft_s.insert(fragile(i * 2));
+		fragile::copies_left = 50;
+		try
+		{
+			ft_s.compact();
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		fragile::copies_left = -1;
+		assert(ft_s.size() == 100);
+		int	expected = 0;
+		for (ft::set<fragile>::iterator it = ft_s.begin(); it != ft_s.end(); ++it, expected += 2)
+			assert(it->value == expected);
+		ft_s.compact();
+		assert(is_contiguous(ft_s) && ft_s.size() == 100);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double						ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, int>			ft_m;
+		std::vector<int>			probes;
+		long						ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			ft_m[rand()] = i;
+			ft::map<int, int>::iterator	it = ft_m.lower_bound(rand());
+			if (i % 2 && it != ft_m.end())
+				ft_m.erase(it);
+		}
+		for (int i = 0; i < LOOKUPS; i++)
+			probes.push_back(ft_m.lower_bound(rand() % ft_m.rbegin()->first)->first);
+		ft::map<int, int>	ft_compact(ft_m);
+		ft_compact.compact();
+		std::cout << "Scanning " << ft_m.size() << " entries " << SCANS << " times and looking up " << LOOKUPS << " keys" << std::endl;
+
+		start_time = wall_time();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (ft::map<int, int>::const_iterator it = ft_compact.begin(); it != ft_compact.end(); ++it)
+				ft_sum += it->second;
+		for (int i = 0; i < LOOKUPS; i++)
+			ft_sum += ft_compact.find(probes[i])->second;
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (compacted) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (ft::map<int, int>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it)
+				std_sum += it->second;
+		for (int i = 0; i < LOOKUPS; i++)
+			std_sum += ft_m.find(probes[i])->second;
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (fragmented) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Compact OK");
+	}
+	return (0);
+}
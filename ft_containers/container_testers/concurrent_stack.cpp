@@ -0,0 +1,218 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:06 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/concurrent_stack.hpp"
+#include "../srcs/stack.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#define THREADS		4
+#define OPERATIONS	200000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Shared state of the producer and consumer threads */
+struct	shared_stack
+{
+	ft::concurrent_stack<long>	stack;
+	long						pushed_sum;
+	long						popped_sum;
+	long						popped_count;
+	pthread_mutex_t				lock;
+};
+
+/* Shared state of the mutex-protected baseline */
+struct	locked_stack
+{
+	ft::stack<long>		stack;
+	pthread_mutex_t		lock;
+};
+
+void	*producer(void *arg)
+{
+	shared_stack	*shared = static_cast<shared_stack *>(arg);
+	long			sum = 0;
+
+	for (long i = 1; i <= OPERATIONS; i++)
+	{
+		shared->stack.push(i);
+		sum += i;
+	}
+	pthread_mutex_lock(&shared->lock);
+	shared->pushed_sum += sum;
+	pthread_mutex_unlock(&shared->lock);
+	return (NULL);
+}
+
+void	*consumer(void *arg)
+{
+	shared_stack	*shared = static_cast<shared_stack *>(arg);
+	long			sum = 0;
+	long			count = 0;
+	long			value;
+
+	while (count < OPERATIONS)
+	{
+		if (shared->stack.try_pop(value))
+		{
+			sum += value;
+			count++;
+		}
+	}
+	pthread_mutex_lock(&shared->lock);
+	shared->popped_sum += sum;
+	shared->popped_count += count;
+	pthread_mutex_unlock(&shared->lock);
+	return (NULL);
+}
+
+void	*lock_free_contention(void *arg)
+{
+	ft::concurrent_stack<long>	*stack = static_cast<ft::concurrent_stack<long> *>(arg);
+	long						value;
+
+	for (long i = 0; i < OPERATIONS; i++)
+	{
+		stack->push(i);
+		stack->try_pop(value);
+	}
+	return (NULL);
+}
+
+void	*mutex_contention(void *arg)
+{
+	locked_stack	*shared = static_cast<locked_stack *>(arg);
+
+	for (long i = 0; i < OPERATIONS; i++)
+	{
+		pthread_mutex_lock(&shared->lock);
+		shared->stack.push(i);
+		pthread_mutex_unlock(&shared->lock);
+		pthread_mutex_lock(&shared->lock);
+		if (shared->stack.empty() == false)
+			shared->stack.pop();
+		pthread_mutex_unlock(&shared->lock);
+	}
+	return (NULL);
+}
+
+double	run_threads(void *(*routine)(void *), void *arg)
+{
+	pthread_t	threads[THREADS];
+	double		start_time = wall_time();
+
+	for (int i = 0; i < THREADS; i++)
+		pthread_create(&threads[i], NULL, routine, arg);
+	for (int i = 0; i < THREADS; i++)
+		pthread_join(threads[i], NULL);
+	return (wall_time() - start_time);
+}
+
+int	main(void)
+{
+	{
+		print_break("Push / Try_pop");
+		ft::concurrent_stack<int>	s;
+		int							value = 0;
+
+		assert(s.empty());
+		assert(s.size() == 0);
+		assert(s.try_pop(value) == false);
+		for (int i = 0; i < 10; i++)
+			s.push(i);
+		assert(s.empty() == false);
+		assert(s.size() == 10);
+		for (int i = 9; i >= 0; i--)
+		{
+			assert(s.try_pop(value));
+			assert(value == i);
+		}
+		assert(s.empty());
+		assert(s.try_pop(value) == false);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Push_range / Pop_all");
+		ft::concurrent_stack<std::string>	s;
+		std::vector<std::string>			in;
+		std::vector<std::string>			out;
+
+		in.push_back("a");
+		in.push_back("b");
+		in.push_back("c");
+		s.push("z");
+		s.push_range(in.begin(), in.end());
+		s.push_range(in.end(), in.end());
+		assert(s.size() == 4);
+		assert(s.pop_all(std::back_inserter(out)) == 4);
+		assert(out.size() == 4);
+		assert(out[0] == "c" && out[1] == "b" && out[2] == "a" && out[3] == "z");
+		assert(s.empty());
+		assert(s.pop_all(std::back_inserter(out)) == 0);
+		s.push_range(in.begin(), in.end());
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Producers / Consumers");
+		shared_stack	shared;
+		pthread_t		threads[THREADS * 2];
+
+		shared.pushed_sum = 0;
+		shared.popped_sum = 0;
+		shared.popped_count = 0;
+		pthread_mutex_init(&shared.lock, NULL);
+		for (int i = 0; i < THREADS; i++)
+		{
+			pthread_create(&threads[i * 2], NULL, producer, &shared);
+			pthread_create(&threads[i * 2 + 1], NULL, consumer, &shared);
+		}
+		for (int i = 0; i < THREADS * 2; i++)
+			pthread_join(threads[i], NULL);
+		pthread_mutex_destroy(&shared.lock);
+		assert(shared.popped_count == (long)THREADS * OPERATIONS);
+		assert(shared.popped_sum == shared.pushed_sum);
+		assert(shared.stack.empty());
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double	ft_elapsed_time, mutex_elapsed_time;
+		print_break("Performance");
+
+		ft::concurrent_stack<long>	lock_free;
+		ft_elapsed_time = run_threads(lock_free_contention, &lock_free);
+		std::cout << "ft::concurrent_stack elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		locked_stack	locked;
+		pthread_mutex_init(&locked.lock, NULL);
+		mutex_elapsed_time = run_threads(mutex_contention, &locked);
+		pthread_mutex_destroy(&locked.lock);
+		std::cout << "mutex + ft::stack elapsed time: " << std::fixed << std::setprecision(6) << mutex_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << mutex_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Concurrent_stack OK");
+	}
+	return (0);
+}
@@ -0,0 +1,335 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:42:11 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:09 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/concurrent_vector.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <string>
+#include <stdexcept>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+
+#define THREADS	4
+#define ITEMS	200000
+#define BATCH	32
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Counts the live copies, throws from the copy constructor once throw_in copies were made and checks it is only destroyed once constructed */
+struct	tracked
+{
+	static int	live;
+	static int	throw_in;
+	int			value;
+	tracked		*self;
+
+	tracked(int v = 0) : value(v), self(this) { live++; };
+	tracked(tracked const &other) : value(other.value), self(this)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("copy");
+		live++;
+	};
+	~tracked()
+	{
+		assert(this->self == this);
+		this->self = NULL;
+		live--;
+	};
+};
+
+int	tracked::live = 0;
+int	tracked::throw_in = 0;
+
+/* Allocator that fails on demand */
+template <class T>
+struct	failing_allocator : public std::allocator<T>
+{
+	static bool	fail;
+
+	template <class U> struct	rebind { typedef failing_allocator<U> other; };
+	failing_allocator() {};
+	failing_allocator(const failing_allocator&) : std::allocator<T>() {};
+	template <class U> failing_allocator(const failing_allocator<U>&) {}
+
+	T	*allocate(std::size_t n, const void* = 0)
+	{
+		if (fail)
+			throw std::bad_alloc();
+		return (std::allocator<T>().allocate(n));
+	};
+};
+
+template <class T> bool	failing_allocator<T>::fail = false;
+
+/* Shared state of the appending threads */
+struct	shared_vector
+{
+	shared_vector() : next(0), batch(false) { pthread_mutex_init(&lock, NULL); };
+	~shared_vector() { pthread_mutex_destroy(&lock); };
+
+	ft::concurrent_vector<long>	vector;
+	std::vector<long>			baseline;
+	long						next;
+	bool						batch;
+	pthread_mutex_t				lock;
+};
+
+/* Each thread appends its own range of values, so the result must hold every value once */
+void	*appender(void *arg)
+{
+	shared_vector	*shared = static_cast<shared_vector *>(arg);
+	long			first;
+
+	pthread_mutex_lock(&shared->lock);
+	first = shared->next;
+	shared->next += ITEMS;
+	pthread_mutex_unlock(&shared->lock);
+	for (long i = first; i < first + ITEMS; i += BATCH)
+	{
+		if (shared->batch)
+		{
+			ft::concurrent_vector<long>::iterator	it = shared->vector.grow_by(BATCH);
+			for (long j = 0; j < BATCH; j++)
+				it[j] = i + j;
+		}
+		else
+		{
+			for (long j = 0; j < BATCH; j++)
+			{
+				ft::concurrent_vector<long>::iterator	it = shared->vector.push_back(i + j);
+				assert(*it == i + j);
+			}
+		}
+		if (i % (BATCH * 256) == 0)
+			sched_yield();
+	}
+	return (NULL);
+}
+
+void	*locked_appender(void *arg)
+{
+	shared_vector	*shared = static_cast<shared_vector *>(arg);
+	long			first;
+
+	pthread_mutex_lock(&shared->lock);
+	first = shared->next;
+	shared->next += ITEMS;
+	pthread_mutex_unlock(&shared->lock);
+	for (long i = first; i < first + ITEMS; i++)
+	{
+		pthread_mutex_lock(&shared->lock);
+		shared->baseline.push_back(i);
+		pthread_mutex_unlock(&shared->lock);
+		if (i % (BATCH * 256) == 0)
+			sched_yield();
+	}
+	return (NULL);
+}
+
+template <class Vector>
+void	check_values(const Vector& v)
+{
+	std::vector<long>	values(v.begin(), v.end());
+
+	assert(values.size() == (std::size_t)THREADS * ITEMS);
+	std::sort(values.begin(), values.end());
+	for (long i = 0; i < (long)values.size(); i++)
+		assert(values[i] == i);
+}
+
+double	run_threads(void *(*append)(void *), shared_vector& shared)
+{
+	pthread_t	threads[THREADS];
+	double		start_time = wall_time();
+	double		elapsed_time;
+
+	for (int i = 0; i < THREADS; i++)
+		pthread_create(&threads[i], NULL, append, &shared);
+	for (int i = 0; i < THREADS; i++)
+		pthread_join(threads[i], NULL);
+	elapsed_time = wall_time() - start_time;
+	if (append == locked_appender)
+		check_values(shared.baseline);
+	else
+		check_values(shared.vector);
+	return (elapsed_time);
+}
+
+int	main(void)
+{
+	{
+		print_break("Push_back / Element access");
+		ft::concurrent_vector<std::string>	v;
+		std::vector<std::string>			std_v;
+
+		assert(v.empty());
+		assert(v.capacity() == 0);
+		for (int i = 0; i < 100; i++)
+		{
+			ft::concurrent_vector<std::string>::iterator	it = v.push_back(std::string(i % 7 + 1, 'a' + i % 26));
+			std_v.push_back(std::string(i % 7 + 1, 'a' + i % 26));
+			assert(it - v.begin() == i);
+		}
+		assert(v.size() == 100);
+		assert(v.capacity() >= 100);
+		assert(std::equal(v.begin(), v.end(), std_v.begin()));
+		assert(std::equal(v.rbegin(), v.rend(), std_v.rbegin()));
+		assert(v.front() == std_v.front());
+		assert(v.back() == std_v.back());
+		assert(v.at(42) == std_v.at(42));
+		try
+		{
+			v.at(100);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Stable references");
+		ft::concurrent_vector<int>	v;
+		std::vector<int*>			addresses;
+
+		for (int i = 0; i < 5000; i++)
+			addresses.push_back(&*v.push_back(i));
+		for (int i = 0; i < 5000; i++)
+		{
+			assert(addresses[i] == &v[i]);
+			assert(*addresses[i] == i);
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Grow_by / Reserve / Copy / Swap / Clear");
+		ft::concurrent_vector<int>	v(3, 7);
+		ft::concurrent_vector<int>	v2;
+
+		ft::concurrent_vector<int>::iterator	it = v.grow_by(10, 1);
+		assert(it == v.begin() + 3);
+		assert(v.size() == 13);
+		assert(std::count(v.begin(), v.end(), 7) == 3);
+		assert(std::count(v.begin(), v.end(), 1) == 10);
+		assert(v.grow_by(0) == v.end());
+		v2.reserve(1000);
+		assert(v2.capacity() >= 1000);
+		assert(v2.empty());
+		v2 = v;
+		assert(v2 == v);
+		v2.push_back(5);
+		assert(v2 != v);
+		ft::concurrent_vector<int>	v3(v2);
+		assert(v3 == v2);
+		v3.swap(v);
+		assert(v3.size() == 13);
+		assert(v.size() == 14 && v.back() == 5);
+		v.clear();
+		assert(v.empty());
+		v.push_back(9);
+		assert(v.size() == 1 && v[0] == 9);
+		try
+		{
+			v.reserve(v.max_size() + 1);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Broken slots");
+		{
+			ft::concurrent_vector<tracked, failing_allocator<tracked> >	v;
+			tracked														value(1);
+
+			for (int i = 0; i < 5; i++)
+				v.push_back(value);
+			tracked::throw_in = 2;
+			try
+			{
+				v.push_back(value);
+				v.push_back(value);
+				assert(false);
+			}
+			catch (std::runtime_error &e) {}
+			tracked::throw_in = 3;
+			try
+			{
+				v.grow_by(6, value);
+				assert(false);
+			}
+			catch (std::runtime_error &e) {}
+			assert(v.size() == 13 && tracked::live == 1 + 6 + 2);
+			failing_allocator<tracked>::fail = true;
+			try
+			{
+				v.grow_by(40, value);
+				assert(false);
+			}
+			catch (std::bad_alloc &e) {}
+			failing_allocator<tracked>::fail = false;
+			v.push_back(value);
+			assert(v.size() == 54 && v.back().value == 1 && tracked::live == 1 + 6 + 2 + 1);
+
+			ft::concurrent_vector<tracked, failing_allocator<tracked> >	copy(v);
+			assert(copy.size() == 9 && tracked::live == 1 + 2 * 9);
+			copy.swap(v);
+			copy.clear();
+			assert(copy.empty() && tracked::live == 1 + 9);
+			copy.push_back(value);
+			tracked::throw_in = 5;
+			try
+			{
+				ft::concurrent_vector<tracked, failing_allocator<tracked> >	broken_copy(v);
+				assert(false);
+			}
+			catch (std::runtime_error &e) {}
+			tracked::throw_in = 0;
+			assert(tracked::live == 1 + 9 + 1);
+		}
+		assert(tracked::live == 0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double	single_elapsed_time, batch_elapsed_time, locked_elapsed_time;
+		print_break("Performance");
+
+		shared_vector	single;
+		single_elapsed_time = run_threads(appender, single);
+		std::cout << "ft::concurrent_vector elapsed time: " << std::fixed << std::setprecision(6) << single_elapsed_time << " seconds" << std::endl;
+
+		shared_vector	batch;
+		batch.batch = true;
+		batch_elapsed_time = run_threads(appender, batch);
+		std::cout << "ft::concurrent_vector (grow_by) elapsed time: " << std::fixed << std::setprecision(6) << batch_elapsed_time << " seconds" << std::endl;
+
+		shared_vector	locked;
+		locked_elapsed_time = run_threads(locked_appender, locked);
+		std::cout << "mutex + std::vector elapsed time: " << std::fixed << std::setprecision(6) << locked_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << locked_elapsed_time / single_elapsed_time << "x times (" << locked_elapsed_time / batch_elapsed_time << "x with grow_by)\n" << std::endl;
+		print_break("All test finished: Concurrent_vector OK");
+	}
+	return (0);
+}
@@ -0,0 +1,261 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cow_vector.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:31:06 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:05:40 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/cow_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#define ELEMENTS	1000000
+#define SNAPSHOTS	1000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class T>
+void	cow_vector_check(ft::cow_vector<T> const &ft_vec, std::vector<T> const &std_vec)
+{
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		assert(ft_vec[i] == std_vec[i]);
+		assert(ft_vec.at(i) == std_vec.at(i));
+		assert(*(ft_vec.begin() + i) == std_vec[i]);
+	}
+	typename ft::cow_vector<T>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	typename std::vector<T>::const_reverse_iterator		std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+}
+
+/* Number of blocks each tagged_allocator id has allocated and not yet freed */
+long	g_live_blocks[2] = { 0, 0 };
+
+/* Stateful allocator that counts its outstanding allocations under its id */
+template <class T>
+class tagged_allocator : public std::allocator<T>
+{
+	public:
+		template <class U>
+		struct	rebind
+		{
+			typedef tagged_allocator<U>	other;
+		};
+
+		int	id;
+
+		tagged_allocator(int id = 0) : std::allocator<T>(), id(id) {};
+		tagged_allocator(const tagged_allocator& other) : std::allocator<T>(other), id(other.id) {};
+		template <class U>
+		tagged_allocator(const tagged_allocator<U>& other) : std::allocator<T>(other), id(other.id) {}
+
+		T	*allocate(size_t n, const void *hint = 0)
+		{
+			(void)hint;
+			T	*ptr = std::allocator<T>::allocate(n);
+			g_live_blocks[this->id]++;
+			return (ptr);
+		};
+		void	deallocate(T *ptr, size_t n)
+		{
+			g_live_blocks[this->id]--;
+			std::allocator<T>::deallocate(ptr, n);
+		};
+		bool	operator==(const tagged_allocator& other) const { return (this->id == other.id); };
+		bool	operator!=(const tagged_allocator& other) const { return (this->id != other.id); };
+};
+
+/* Throws from the copy constructor once throw_in copies were made */
+struct	tracked
+{
+	static int	throw_in;
+	int			value;
+
+	tracked(int v = 0) : value(v) {};
+	tracked(tracked const &other) : value(other.value)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("copy");
+	};
+	bool	operator==(tracked const &other) const { return (this->value == other.value); };
+};
+
+int	tracked::throw_in = 0;
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		std::vector<std::string>		std_v1;
+		std::vector<std::string>		std_v2(5, "42");
+		ft::cow_vector<std::string>		ft_v1;
+		ft::cow_vector<std::string>		ft_v2(5, "42");
+		ft::cow_vector<std::string>		ft_v3(std_v2.begin(), std_v2.end());
+		ft::vector<std::string>			vec(std_v2.begin(), std_v2.end());
+		ft::cow_vector<std::string>		ft_v4(vec);
+
+		cow_vector_check(ft_v1, std_v1);
+		cow_vector_check(ft_v2, std_v2);
+		cow_vector_check(ft_v3, std_v2);
+		cow_vector_check(ft_v4, std_v2);
+		assert(ft_v4.get() == vec);
+		assert(ft_v2 == ft_v3 && !(ft_v2 < ft_v3) && ft_v1 < ft_v2);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Sharing / Copy on write");
+		ft::cow_vector<int>	ft_v1;
+		std::vector<int>	std_v1;
+
+		for (int i = 0; i < 100; i++)
+		{
+			ft_v1.push_back(i);
+			std_v1.push_back(i);
+		}
+		const ft::cow_vector<int>	snapshot(ft_v1);
+		ft::cow_vector<int>			ft_v2;
+		ft_v2 = snapshot;
+		assert(ft_v1.use_count() == 3);
+		assert(snapshot.data() == ft_v2.get().data());
+
+		ft_v1[0] = -1;
+		assert(ft_v1.use_count() == 1 && snapshot.use_count() == 2);
+		assert(snapshot[0] == 0 && ft_v1[0] == -1);
+		cow_vector_check(ft_v2, std_v1);
+
+		ft_v2.push_back(100);
+		assert(snapshot.use_count() == 1);
+		cow_vector_check(snapshot, std_v1);
+		std_v1.push_back(100);
+		cow_vector_check(ft_v2, std_v1);
+
+		ft::cow_vector<int>	ft_v3(ft_v2);
+		ft_v3.insert(ft_v3.begin() + 10, 3, 7);
+		ft::cow_vector<int>::iterator	it = ft_v3.insert(ft_v3.begin() + 2, -2);
+		std_v1.insert(std_v1.begin() + 10, 3, 7);
+		std_v1.insert(std_v1.begin() + 2, -2);
+		assert(*it == -2 && it == ft_v3.begin() + 2);
+		cow_vector_check(ft_v3, std_v1);
+		assert(ft_v2.size() == 101 && ft_v2[10] == 10);
+
+		ft::cow_vector<int>	ft_v4(ft_v3);
+		ft_v4.erase(ft_v4.begin() + 5, ft_v4.begin() + 20);
+		std::vector<int>	std_v4(std_v1);
+		std_v4.erase(std_v4.begin() + 5, std_v4.begin() + 20);
+		cow_vector_check(ft_v4, std_v4);
+		cow_vector_check(ft_v3, std_v1);
+
+		ft::cow_vector<int>	ft_v5(ft_v3);
+		ft_v5.clear();
+		assert(ft_v5.empty() && ft_v3.size() == std_v1.size() && ft_v3.use_count() == 1);
+		ft_v5.swap(ft_v3);
+		cow_vector_check(ft_v5, std_v1);
+		assert(ft_v3.empty());
+		try
+		{
+			ft_v3.at(0);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Allocators and exceptions");
+		typedef ft::cow_vector<tracked, tagged_allocator<tracked> >	cow_type;
+		tagged_allocator<tracked>	alloc(1);
+		{
+			cow_type	ft_v1(10, tracked(3), alloc);
+			assert(ft_v1.get_allocator().id == 1 && ft_v1.get().get_allocator().id == 1);
+			assert(g_live_blocks[0] == 0 && g_live_blocks[1] == 2);
+
+			cow_type	ft_v2(ft_v1);
+			tracked::throw_in = 5;
+			try
+			{
+				ft_v2.push_back(tracked(4));
+				assert(false);
+			}
+			catch (const std::runtime_error&) {}
+			assert(ft_v1.use_count() == 2 && ft_v2.size() == 10 && g_live_blocks[1] == 2);
+			ft_v2.push_back(tracked(4));
+			assert(ft_v1.use_count() == 1 && ft_v2.size() == 11 && ft_v2.back().value == 4);
+			assert(g_live_blocks[0] == 0 && g_live_blocks[1] == 4);
+
+			tracked::throw_in = 5;
+			try
+			{
+				cow_type	ft_v3(10, tracked(5), alloc);
+				assert(false);
+			}
+			catch (const std::runtime_error&) {}
+			ft::vector<tracked, tagged_allocator<tracked> >	vec(ft_v2.begin(), ft_v2.end(), alloc);
+			tracked::throw_in = 5;
+			try
+			{
+				cow_type	ft_v3(vec);
+				assert(false);
+			}
+			catch (const std::runtime_error&) {}
+			tracked::throw_in = 0;
+			assert(g_live_blocks[1] == 5);
+		}
+		assert(g_live_blocks[0] == 0 && g_live_blocks[1] == 0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		clock_t	start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		long	sum = 0;
+		print_break("Performance");
+
+		ft::cow_vector<int>	ft_v(ELEMENTS, 1);
+		std::vector<int>	std_v(ELEMENTS, 1);
+
+		start_time = clock();
+		for (int i = 0; i < SNAPSHOTS; i++)
+		{
+			const ft::cow_vector<int>	snapshot(ft_v);
+			sum += snapshot[i];
+		}
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = clock();
+		for (int i = 0; i < SNAPSHOTS; i++)
+		{
+			const std::vector<int>	snapshot(std_v);
+			sum += snapshot[i];
+		}
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(sum == SNAPSHOTS * 2);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Cow_vector OK");
+	}
+	return (0);
+}
@@ -0,0 +1,205 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   erase_if.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 02:26:13 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:12 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#define ENTRIES		2000000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Selects the elements whose key falls on one of the divisor's multiples */
+struct	key_divisible
+{
+	int	divisor;
+
+	key_divisible(int d) : divisor(d) {};
+
+	bool	operator()(ft::pair<const int, std::string> const &value) const { return (value.first % this->divisor == 0); };
+	bool	operator()(std::pair<const int, std::string> const &value) const { return (value.first % this->divisor == 0); };
+	bool	operator()(int key) const { return (key % this->divisor == 0); };
+};
+
+/* Throws on the element with key trap */
+struct	trap_predicate
+{
+	int	trap;
+
+	trap_predicate(int t) : trap(t) {};
+
+	bool	operator()(int key) const
+	{
+		if (key == this->trap)
+			throw std::runtime_error("trap_predicate: trap reached");
+		return (key % 2 == 0);
+	};
+};
+
+/* Selects the entries of the hourly clean-up */
+struct	expired
+{
+	bool	operator()(ft::pair<const int, int> const &value) const { return (value.second % 100 < 45); };
+	bool	operator()(std::pair<const int, int> const &value) const { return (value.second % 100 < 45); };
+};
+
+template <class Key, class T>
+void	map_check(ft::map<Key, T> const &ft_m, std::map<Key, T> const &std_m)
+{
+	tree_check(ft_m);
+	assert(ft_m.size() == std_m.size());
+	typename std::map<Key, T>::const_iterator	std_it = std_m.begin();
+	for (typename ft::map<Key, T>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it, ++std_it)
+		assert(it->first == std_it->first && it->second == std_it->second);
+	typename std::map<Key, T>::const_reverse_iterator	std_rit = std_m.rbegin();
+	for (typename ft::map<Key, T>::const_reverse_iterator it = ft_m.rbegin(); it != ft_m.rend(); ++it, ++std_rit)
+		assert(it->first == std_rit->first);
+}
+
+/* Erase_if for std::map, which only has it from C++20 */
+template <class Key, class T, class Predicate>
+size_t	std_erase_if(std::map<Key, T> &std_m, Predicate pred)
+{
+	size_t	count = 0;
+
+	for (typename std::map<Key, T>::iterator it = std_m.begin(); it != std_m.end();)
+	{
+		if (pred(*it))
+		{
+			std_m.erase(it++);
+			count++;
+		}
+		else
+			++it;
+	}
+	return (count);
+}
+
+int	main(void)
+{
+	{
+		print_break("Map");
+		const double	fractions[] = { 0.0, 0.25, 1.0 };
+		srand(42);
+		for (int round = 0; round < 120; round++)
+		{
+			ft::map<int, std::string>	ft_m;
+			std::map<int, std::string>	std_m;
+			int							n = rand() % 400;
+			double						fraction = fractions[round % 3];
+
+			for (int i = 0; i < n; i++)
+			{
+				int	key = rand() % 1000;
+				ft_m[key] = std::string(key % 5 + 1, 'a' + key % 26);
+				std_m[key] = std::string(key % 5 + 1, 'a' + key % 26);
+			}
+			if (round % 5 == 0)
+				ft_m.compact();
+			for (int divisor = 7; divisor > 0 && ft_m.empty() == false; divisor -= 2)
+			{
+				assert(ft::erase_if(ft_m, key_divisible(divisor), fraction) == std_erase_if(std_m, key_divisible(divisor)));
+				map_check(ft_m, std_m);
+				ft_m[divisor * 11] = "new";
+				std_m[divisor * 11] = "new";
+				map_check(ft_m, std_m);
+			}
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		const double	fractions[] = { 0.25, 1.0 };
+		ft::set<int>	ft_s;
+		for (int f = 0; f < 2; f++)
+		{
+			ft_s.clear();
+			for (int i = 0; i < 1000; i++)
+				ft_s.insert(i);
+			try
+			{
+				ft::erase_if(ft_s, trap_predicate(700), fractions[f]);
+				assert(false);
+			}
+			catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+			assert(ft_s.size() == 650);
+			tree_check(ft_s);
+			for (int i = 0; i < 1000; i++)
+				assert(ft_s.count(i) == static_cast<size_t>(i >= 700 || i % 2 == 1));
+		}
+		assert(ft::erase_if(ft_s, trap_predicate(-1)) == 150);
+		tree_check(ft_s);
+		for (ft::set<int>::iterator it = ft_s.begin(); it != ft_s.end(); ++it)
+			assert(*it % 2 == 1);
+		assert(ft::erase_if(ft_s, key_divisible(2)) == 0 && ft_s.size() == 500);
+		assert(ft::erase_if(ft_s, key_divisible(1)) == 500 && ft_s.empty());
+		tree_check(ft_s);
+		ft_s.insert(3);
+		assert(ft_s.size() == 1 && *ft_s.begin() == 3 && *--ft_s.end() == 3);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double					ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, int>		ft_m, ft_single;
+		std::map<int, int>		std_m;
+		size_t					ft_count, std_count;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			int	key = rand();
+			ft_m[key] = i;
+			ft_single[key] = i;
+			std_m[key] = i;
+		}
+		std::cout << "Removing 45% of " << ft_m.size() << " entries" << std::endl;
+
+		start_time = wall_time();
+		ft_count = ft::erase_if(ft_m, expired());
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (erase_if) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		std_count = ft::erase_if(ft_single, expired(), 1.0);
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (erase_if without rebuild) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_count == std_count && ft_m == ft_single);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		start_time = wall_time();
+		std_count = std_erase_if(std_m, expired());
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std (erase loop) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_count == std_count);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Erase_if OK");
+	}
+	return (0);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   find_batch.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:24:08 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:15 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <functional>
+
+#define ENTRIES		2000000
+#define LOOKUPS		1000000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Checks find_batch on keys against one find per key */
+template <class Container>
+void	find_batch_check(Container &ft_c, std::vector<typename Container::key_type> const &keys)
+{
+	std::vector<typename Container::iterator>		found(keys.size() + 1);
+	std::vector<typename Container::const_iterator>	const_found;
+	Container const									&const_c = ft_c;
+
+	typename std::vector<typename Container::iterator>::iterator	out = ft_c.find_batch(keys.begin(), keys.end(), found.begin());
+	assert(out == found.begin() + keys.size());
+	const_c.find_batch(keys.begin(), keys.end(), std::back_inserter(const_found));
+	assert(const_found.size() == keys.size());
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		assert(found[i] == ft_c.find(keys[i]));
+		assert(const_found[i] == const_c.find(keys[i]));
+	}
+}
+
+int	main(void)
+{
+	{
+		print_break("Map");
+		for (int n = 0; n < 200; n += 9)
+		{
+			ft::map<int, std::string>	ft_m;
+			std::vector<int>			keys;
+
+			for (int i = 0; i < n; i++)
+				ft_m[i * 2] = std::string(i % 5 + 1, 'a' + i % 26);
+			for (int i = -3; i < n * 2 + 3; i++)
+				keys.push_back((i * 7) % (n * 2 + 3));
+			find_batch_check(ft_m, keys);
+			find_batch_check(ft_m, std::vector<int>());
+			find_batch_check(ft_m, std::vector<int>(1, n));
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		ft::set<long, std::greater<long> >	ft_s;
+		std::vector<long>					keys;
+		srand(42);
+		for (int i = 0; i < 5000; i++)
+			ft_s.insert(rand() % 20000);
+		for (int i = 0; i < 10003; i++)
+			keys.push_back(rand() % 20010 - 5);
+		find_batch_check(ft_s, keys);
+
+		ft::set<long, std::greater<long> >::iterator	found[3];
+		long											three[3] = { *ft_s.begin(), -1, *ft_s.rbegin() };
+		assert(ft_s.find_batch(three, three + 3, found) == found + 3);
+		assert(found[0] == ft_s.begin() && found[1] == ft_s.end() && found[2] == --ft_s.end());
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double										ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, int>							ft_m;
+		std::map<int, int>							std_m;
+		std::vector<int>							probes;
+		std::vector<ft::map<int, int>::iterator>	found(LOOKUPS);
+		long										ft_sum = 0, scalar_sum = 0, std_sum = 0;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			int	key = rand();
+			ft_m[key] = i;
+			std_m[key] = i;
+		}
+		for (int i = 0; i < LOOKUPS; i++)
+			probes.push_back(i % 2 ? rand() : ft_m.lower_bound(rand())->first);
+		std::cout << "Looking up " << LOOKUPS << " keys in " << ft_m.size() << " entries" << std::endl;
+
+		start_time = wall_time();
+		ft_m.find_batch(probes.begin(), probes.end(), found.begin());
+		for (int i = 0; i < LOOKUPS; i++)
+			if (found[i] != ft_m.end())
+				ft_sum += found[i]->second;
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (find_batch) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < LOOKUPS; i++)
+		{
+			ft::map<int, int>::iterator	it = ft_m.find(probes[i]);
+			if (it != ft_m.end())
+				scalar_sum += it->second;
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (find) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == scalar_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < LOOKUPS; i++)
+		{
+			std::map<int, int>::iterator	it = std_m.find(probes[i]);
+			if (it != std_m.end())
+				std_sum += it->second;
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std (find) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Find_batch OK");
+	}
+	return (0);
+}
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:47:15 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:18 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/set.hpp"
+#include "../srcs/map.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <set>
+#include <map>
+#include <vector>
+#include <functional>
+
+#define KEYS		(1 << 22)
+#define LOOKUPS		(1 << 21)
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Counts the live copies, throws from the copy constructor once throw_in copies were made and checks it is only destroyed once constructed */
+struct	tracked
+{
+	static int	live;
+	static int	throw_in;
+	int			value;
+	tracked		*self;
+
+	tracked(int v = 0) : value(v), self(this) { live++; };
+	tracked(tracked const &other) : value(other.value), self(this)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("copy");
+		live++;
+	};
+	~tracked()
+	{
+		assert(this->self == this);
+		this->self = NULL;
+		live--;
+	};
+	bool	operator<(tracked const &other) const { return (this->value < other.value); };
+	bool	operator==(tracked const &other) const { return (this->value == other.value); };
+};
+
+int	tracked::live = 0;
+int	tracked::throw_in = 0;
+
+template <class Key, class Compare>
+void	frozen_set_check(ft::frozen_set<Key, Compare> const &ft_s, std::set<Key, Compare> const &std_s, Key probe_min, Key probe_max)
+{
+	assert(ft_s.empty() == std_s.empty());
+	assert(ft_s.size() == std_s.size());
+	typename ft::frozen_set<Key, Compare>::const_iterator	ft_it = ft_s.begin();
+	typename std::set<Key, Compare>::const_iterator			std_it = std_s.begin();
+	for (; std_it != std_s.end(); ft_it++, std_it++)
+		assert(*ft_it == *std_it);
+	assert(ft_it == ft_s.end());
+	typename ft::frozen_set<Key, Compare>::const_reverse_iterator	ft_rit = ft_s.rbegin();
+	typename std::set<Key, Compare>::const_reverse_iterator			std_rit = std_s.rbegin();
+	for (; std_rit != std_s.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_s.rend());
+	for (Key key = probe_min; key <= probe_max; key++)
+	{
+		assert(ft_s.count(key) == std_s.count(key));
+		assert((ft_s.find(key) == ft_s.end()) == (std_s.find(key) == std_s.end()));
+		assert((ft_s.lower_bound(key) == ft_s.end()) == (std_s.lower_bound(key) == std_s.end()));
+		assert((ft_s.upper_bound(key) == ft_s.end()) == (std_s.upper_bound(key) == std_s.end()));
+		if (ft_s.lower_bound(key) != ft_s.end())
+			assert(*ft_s.lower_bound(key) == *std_s.lower_bound(key));
+		if (ft_s.upper_bound(key) != ft_s.end())
+			assert(*ft_s.upper_bound(key) == *std_s.upper_bound(key));
+		assert(ft_s.equal_range(key).second == ft_s.upper_bound(key));
+	}
+}
+
+int	main(void)
+{
+	{
+		print_break("Frozen_set");
+		for (int n = 0; n < 200; n++)
+		{
+			ft::set<int>	ft_s;
+			std::set<int>	std_s;
+
+			for (int i = 0; i < n; i++)
+			{
+				ft_s.insert(i * 3);
+				std_s.insert(i * 3);
+			}
+			ft::frozen_set<int>	frozen = ft_s.freeze();
+			frozen_set_check(frozen, std_s, -2, n * 3 + 2);
+		}
+		ft::set<int, std::greater<int> >	ft_s;
+		std::set<int, std::greater<int> >	std_s;
+		srand(42);
+		for (int i = 0; i < 1000; i++)
+		{
+			int	key = rand() % 5000;
+			ft_s.insert(key);
+			std_s.insert(key);
+		}
+		ft::frozen_set<int, std::greater<int> >	frozen = ft_s.freeze();
+		frozen_set_check(frozen, std_s, -10, 5010);
+		ft::frozen_set<int, std::greater<int> >	copy(frozen);
+		ft::frozen_set<int, std::greater<int> >	other;
+		assert(copy == frozen && other != frozen);
+		other = frozen;
+		assert(other == frozen);
+		other.swap(copy);
+		assert(copy == frozen);
+		{
+			std::vector<tracked>			values;
+			for (int i = 0; i < 20; i++)
+				values.push_back(tracked(i));
+			ft::frozen_set<tracked>	tracked_set(values.begin(), values.end());
+			tracked::throw_in = 7;
+			try
+			{
+				ft::frozen_set<tracked>	tracked_copy(tracked_set);
+				assert(false);
+			}
+			catch (std::runtime_error &e)
+			{
+				std::cout << "Copy exception caught" << std::endl;
+			}
+			tracked::throw_in = 0;
+			assert(tracked::live == 40);
+		}
+		assert(tracked::live == 0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Frozen_map");
+		ft::map<std::string, int>	ft_m;
+		std::map<std::string, int>	std_m;
+
+		for (int i = 0; i < 500; i++)
+		{
+			std::string	key(1 + i % 7, static_cast<char>('a' + i % 26));
+			ft_m[key] = i;
+			std_m[key] = i;
+		}
+		ft::frozen_map<std::string, int>	frozen = ft_m.freeze();
+		assert(frozen.size() == std_m.size());
+		ft::frozen_map<std::string, int>::const_iterator	ft_it = frozen.begin();
+		for (std::map<std::string, int>::iterator std_it = std_m.begin(); std_it != std_m.end(); ft_it++, std_it++)
+		{
+			assert(ft_it->first == std_it->first && ft_it->second == std_it->second);
+			assert(frozen.at(std_it->first) == std_it->second);
+			assert(frozen.find(std_it->first)->second == std_it->second);
+		}
+		assert(ft_it == frozen.end());
+		assert(frozen.lower_bound("b")->first == std_m.lower_bound("b")->first);
+		assert(frozen.upper_bound("b")->first == std_m.upper_bound("b")->first);
+		assert(frozen.count("zz") == std_m.count("zz") && frozen.rbegin()->first == std_m.rbegin()->first);
+		try
+		{
+			frozen.at("missing");
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double				ft_elapsed_time, std_elapsed_time, start_time;
+		long				ft_found = 0, std_found = 0;
+		std::vector<int>	probes;
+		ft::set<int>		ft_s;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < KEYS; i++)
+			ft_s.insert(rand());
+		for (int i = 0; i < LOOKUPS; i++)
+			probes.push_back(rand());
+		ft::frozen_set<int>	frozen = ft_s.freeze();
+		std::cout << LOOKUPS << " lookups in a set of " << ft_s.size() << " ints" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < LOOKUPS; i++)
+			ft_found += (frozen.lower_bound(probes[i]) != frozen.end());
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (frozen_set) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < LOOKUPS; i++)
+			std_found += (ft_s.lower_bound(probes[i]) != ft_s.end());
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (set) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_found == std_found);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Frozen OK");
+	}
+	return (0);
+}
@@ -0,0 +1,222 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_file.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:38:54 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:21 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/mapped_frozen_map.hpp"
+#include "../srcs/mapped_frozen_set.hpp"
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <functional>
+
+#define PATH		"/tmp/ft_frozen_file.bin"
+#define ENTRIES		2000000
+#define LOOKUPS		100000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Overwrites one byte of the file at offset */
+void	patch_file(const char *path, long offset, char byte)
+{
+	std::FILE	*file = std::fopen(path, "r+b");
+
+	assert(file != NULL);
+	assert(std::fseek(file, offset, SEEK_SET) == 0);
+	assert(std::fputc(byte, file) != EOF);
+	std::fclose(file);
+}
+
+template <class Key, class T>
+void	mapped_frozen_map_check(ft::mapped_frozen_map<Key, T> const &ft_file, ft::map<Key, T> const &ft_map, Key probe_min, Key probe_max)
+{
+	assert(ft_file.empty() == ft_map.empty());
+	assert(ft_file.size() == ft_map.size());
+	typename ft::mapped_frozen_map<Key, T>::const_iterator	file_it = ft_file.begin();
+	typename ft::map<Key, T>::const_iterator				map_it = ft_map.begin();
+	for (; map_it != ft_map.end(); file_it++, map_it++)
+		assert((*file_it).first == map_it->first && file_it.value() == map_it->second);
+	assert(file_it == ft_file.end());
+	for (Key key = probe_min; key <= probe_max; key++)
+	{
+		assert(ft_file.count(key) == ft_map.count(key));
+		assert(ft_file.lower_bound(key) - ft_file.begin() == std::distance(ft_map.begin(), ft_map.lower_bound(key)));
+		assert(ft_file.upper_bound(key) - ft_file.begin() == std::distance(ft_map.begin(), ft_map.upper_bound(key)));
+		if (ft_map.count(key))
+			assert(ft_file.at(key) == ft_map.at(key) && ft_file.find(key).key() == key);
+		assert(ft_file.equal_range(key).second - ft_file.equal_range(key).first == static_cast<long>(ft_map.count(key)));
+	}
+}
+
+int	main(void)
+{
+	{
+		print_break("Mapped_frozen_map");
+		for (int n = 0; n < 300; n += 7)
+		{
+			ft::map<int, double>	ft_m;
+
+			for (int i = 0; i < n; i++)
+				ft_m[i * 3] = i * 0.5;
+			ft::mapped_frozen_map<int, double>::write(PATH, ft_m.begin(), ft_m.end());
+			ft::mapped_frozen_map<int, double>	ft_file(PATH);
+			assert(ft_file.verify());
+			mapped_frozen_map_check(ft_file, ft_m, -2, n * 3 + 2);
+
+			ft::map<int, double>	loaded(ft::sorted_unique, ft_file.begin(), ft_file.end());
+			assert(loaded == ft_m);
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Mapped_frozen_set");
+		ft::set<long, std::greater<long> >	ft_s;
+		srand(42);
+		for (int i = 0; i < 5000; i++)
+			ft_s.insert(rand() % 20000);
+		ft::mapped_frozen_set<long, std::greater<long> >::write(PATH, ft_s.begin(), ft_s.end());
+		ft::mapped_frozen_set<long, std::greater<long> >	ft_file(PATH);
+		assert(ft_file.verify() && ft_file.size() == ft_s.size());
+		assert(ft::equal(ft_s.begin(), ft_s.end(), ft_file.begin()));
+		assert(*ft_file.rbegin() == *ft_s.rbegin());
+		for (long key = -5; key < 20005; key++)
+		{
+			assert(ft_file.count(key) == ft_s.count(key));
+			assert(ft_file.lower_bound(key) - ft_file.begin() == std::distance(ft_s.begin(), ft_s.lower_bound(key)));
+			assert(ft_file.upper_bound(key) - ft_file.begin() == std::distance(ft_s.begin(), ft_s.upper_bound(key)));
+		}
+		ft::set<long, std::greater<long> >	loaded(ft::sorted_unique, ft_file.begin(), ft_file.end());
+		assert(loaded == ft_s);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Invalid files");
+		ft::set<int>	ft_s;
+		for (int i = 0; i < 1000; i++)
+			ft_s.insert(i);
+		ft::mapped_frozen_set<int>::write(PATH, ft_s.begin(), ft_s.end());
+		patch_file(PATH, 128 + 40, 0x7f);
+		{
+			ft::mapped_frozen_set<int>	ft_file(PATH);
+			assert(ft_file.verify() == false);
+		}
+		try
+		{
+			ft::mapped_frozen_set<long>	wrong(PATH);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		patch_file(PATH, 8, 2);
+		try
+		{
+			ft::mapped_frozen_set<int>	newer(PATH);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		patch_file(PATH, 0, 'x');
+		try
+		{
+			ft::mapped_frozen_set<int>	garbage(PATH);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		try
+		{
+			ft::frozen_file_writer	writer(PATH, sizeof(int), 0, 2);
+			int						key = 1;
+			writer.append(&key, NULL);
+			writer.finish();
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	std::remove(PATH);
+	{
+		double						ft_elapsed_time, std_elapsed_time, start_time;
+		double						ft_sum = 0, std_sum = 0;
+		std::vector<int>			probes;
+		ft::map<int, double>		ft_m;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+			ft_m[rand()] = i;
+		for (int i = 0; i < LOOKUPS; i++)
+			probes.push_back(rand());
+		ft::mapped_frozen_map<int, double>::write(PATH, ft_m.begin(), ft_m.end());
+		std::cout << "Opening " << ft_m.size() << " entries and looking up " << LOOKUPS << " keys" << std::endl;
+
+		start_time = wall_time();
+		{
+			ft::mapped_frozen_map<int, double>	ft_file(PATH);
+			for (int i = 0; i < LOOKUPS; i++)
+				if (ft_file.count(probes[i]))
+					ft_sum += ft_file.at(probes[i]);
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (mapped) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		{
+			ft::mapped_frozen_map<int, double>	ft_file(PATH);
+			ft::map<int, double>				loaded;
+			for (ft::mapped_frozen_map<int, double>::const_iterator it = ft_file.begin(); it != ft_file.end(); ++it)
+				loaded.insert(*it);
+			for (int i = 0; i < LOOKUPS; i++)
+				if (loaded.count(probes[i]))
+					std_sum += loaded.at(probes[i]);
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (reinsert) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		std::cout << "Loading " << ft_m.size() << " entries into ft::map" << std::endl;
+		start_time = wall_time();
+		{
+			ft::mapped_frozen_map<int, double>	ft_file(PATH);
+			ft::map<int, double>				loaded(ft::sorted_unique, ft_file.begin(), ft_file.end());
+			assert(loaded.size() == ft_m.size());
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (sorted_unique) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		{
+			ft::mapped_frozen_map<int, double>	ft_file(PATH);
+			ft::map<int, double>				loaded;
+			for (ft::mapped_frozen_map<int, double>::const_iterator it = ft_file.begin(); it != ft_file.end(); ++it)
+				loaded.insert(*it);
+			assert(loaded.size() == ft_m.size());
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (insert) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Frozen_file OK");
+	}
+	std::remove(PATH);
+	return (0);
+}
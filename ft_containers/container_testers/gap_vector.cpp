@@ -0,0 +1,291 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gap_vector.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:54:37 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 10:14:36 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/gap_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define TEXT	1000000
+#define EDITS	200000
+
+template <class T>
+void	ft_gap_vector_print(ft::gap_vector<T> const &vec)
+{
+	std::cout << "Size: " << vec.size() << std::endl;
+	std::cout << "Gap: " << vec.gap_index() << " (" << vec.gap_size() << " free)" << std::endl;
+	std::cout << "Content: " << std::endl;
+	for (typename ft::gap_vector<T>::const_iterator it = vec.begin(); it != vec.end(); it++)
+		std::cout << *it << " ";
+	std::cout << "\n" << std::endl;
+}
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class T>
+void	gap_vector_check(ft::gap_vector<T> const &ft_vec, std::vector<T> const &std_vec)
+{
+	ft_gap_vector_print(ft_vec);
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	assert(ft_vec.capacity() >= ft_vec.size());
+	assert(ft_vec.end() - ft_vec.begin() == static_cast<std::ptrdiff_t>(std_vec.size()));
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		assert(ft_vec[i] == std_vec[i]);
+		assert(*(ft_vec.begin() + i) == std_vec[i]);
+		assert(ft_vec.begin()[i] == std_vec[i]);
+	}
+	typename ft::gap_vector<T>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	typename std::vector<T>::const_reverse_iterator		std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+}
+
+/* Counts the live copies and throws from the copy constructor once throw_in copies were made */
+struct	tracked
+{
+	static int	live;
+	static int	throw_in;
+	int			value;
+
+	tracked(int v = 0) : value(v) { live++; };
+	tracked(tracked const &other) : value(other.value)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("copy");
+		live++;
+	};
+	~tracked() { live--; };
+	tracked	&operator=(tracked const &other) { this->value = other.value; return (*this); };
+	bool	operator==(tracked const &other) const { return (this->value == other.value); };
+};
+
+int	tracked::live = 0;
+int	tracked::throw_in = 0;
+
+std::ostream	&operator<<(std::ostream &os, tracked const &t)
+{
+	return (os << t.value);
+}
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		std::vector<int>		std_v1;
+		std::vector<int>		std_v2(5, 42);
+		std::vector<int>		std_v3;
+		for (int i = 0; i < 10; i++)
+			std_v3.push_back(i);
+
+		ft::gap_vector<int>		ft_v1;
+		ft::gap_vector<int>		ft_v2(5, 42);
+		ft::gap_vector<int>		ft_v3(std_v3.begin(), std_v3.end());
+		ft::gap_vector<int>		ft_v4(ft_v3);
+
+		gap_vector_check(ft_v1, std_v1);
+		gap_vector_check(ft_v2, std_v2);
+		gap_vector_check(ft_v3, std_v3);
+		gap_vector_check(ft_v4, std_v3);
+
+		print_break("Insert around a cursor");
+		ft_v3.insert(ft_v3.begin() + 4, 100);
+		std_v3.insert(std_v3.begin() + 4, 100);
+		gap_vector_check(ft_v3, std_v3);
+		assert(ft_v3.gap_index() == 5);
+		for (int i = 0; i < 3; i++)
+		{
+			ft_v3.insert(ft_v3.begin() + 5 + i, 101 + i);
+			std_v3.insert(std_v3.begin() + 5 + i, 101 + i);
+		}
+		gap_vector_check(ft_v3, std_v3);
+		ft_v3.insert(ft_v3.begin() + 1, 3, -1);
+		std_v3.insert(std_v3.begin() + 1, 3, -1);
+		ft_v3.insert(ft_v3.end() - 2, std_v2.begin(), std_v2.end());
+		std_v3.insert(std_v3.end() - 2, std_v2.begin(), std_v2.end());
+		gap_vector_check(ft_v3, std_v3);
+
+		print_break("Erase");
+		ft_v3.erase(ft_v3.begin() + 2);
+		std_v3.erase(std_v3.begin() + 2);
+		gap_vector_check(ft_v3, std_v3);
+		ft_v3.erase(ft_v3.begin() + 10, ft_v3.begin() + 15);
+		std_v3.erase(std_v3.begin() + 10, std_v3.begin() + 15);
+		gap_vector_check(ft_v3, std_v3);
+		ft_v3.erase(ft_v3.begin(), ft_v3.begin() + 3);
+		std_v3.erase(std_v3.begin(), std_v3.begin() + 3);
+		ft_v3.pop_back();
+		std_v3.pop_back();
+		gap_vector_check(ft_v3, std_v3);
+
+		print_break("Data closes the gap");
+		int	*data = ft_v3.data();
+		assert(ft_v3.gap_index() == ft_v3.size());
+		for (std::size_t i = 0; i < std_v3.size(); i++)
+			assert(data[i] == std_v3[i]);
+		gap_vector_check(ft_v3, std_v3);
+
+		print_break("Full buffer");
+		ft::gap_vector<int>		ft_full(4, 7);
+		std::vector<int>		std_full(4, 7);
+		assert(ft_full.gap_size() == 0);
+		ft_full.erase(ft_full.begin() + 1);
+		std_full.erase(std_full.begin() + 1);
+		gap_vector_check(ft_full, std_full);
+		ft::gap_vector<int>		ft_pushed;
+		std::vector<int>		std_pushed;
+		for (int i = 0; i < 16; i++)
+		{
+			ft_pushed.push_back(i);
+			std_pushed.push_back(i);
+		}
+		assert(ft_pushed.gap_size() == 0);
+		data = ft_pushed.data();
+		assert(data[15] == 15 && ft_pushed.gap_size() == 0);
+		gap_vector_check(ft_pushed, std_pushed);
+		ft_pushed.erase(ft_pushed.begin() + 3, ft_pushed.begin() + 5);
+		std_pushed.erase(std_pushed.begin() + 3, std_pushed.begin() + 5);
+		ft_pushed.erase(ft_pushed.begin());
+		std_pushed.erase(std_pushed.begin());
+		gap_vector_check(ft_pushed, std_pushed);
+
+		print_break("Non-trivial elements");
+		ft::gap_vector<std::string>		ft_s;
+		std::vector<std::string>		std_s;
+		for (int i = 0; i < 30; i++)
+		{
+			const std::size_t	pos = (i * 7) % (std_s.size() + 1);
+			ft_s.insert(ft_s.begin() + pos, std::string(i % 5 + 1, 'a' + i % 26));
+			std_s.insert(std_s.begin() + pos, std::string(i % 5 + 1, 'a' + i % 26));
+		}
+		gap_vector_check(ft_s, std_s);
+		for (int i = 0; i < 10; i++)
+		{
+			const std::size_t	pos = (i * 5) % std_s.size();
+			ft_s.erase(ft_s.begin() + pos);
+			std_s.erase(std_s.begin() + pos);
+		}
+		gap_vector_check(ft_s, std_s);
+
+		print_break("Throwing copy while the gap moves");
+		{
+			ft::gap_vector<tracked>		ft_t;
+			std::vector<tracked>		std_t;
+			for (int i = 0; i < 6; i++)
+			{
+				ft_t.push_back(tracked(i));
+				std_t.push_back(tracked(i));
+			}
+			assert(ft_t.gap_size() > 0);
+			tracked::throw_in = 4;
+			try
+			{
+				ft_t.insert(ft_t.begin(), tracked(-1));
+				assert(false);
+			}
+			catch (std::runtime_error &e)
+			{
+				std::cout << "Copy exception caught" << std::endl;
+			}
+			tracked::throw_in = 0;
+			gap_vector_check(ft_t, std_t);
+			assert(tracked::live == static_cast<int>(ft_t.size() + std_t.size()));
+			ft_t.erase(ft_t.begin() + 2);
+			std_t.erase(std_t.begin() + 2);
+			gap_vector_check(ft_t, std_t);
+		}
+		assert(tracked::live == 0);
+
+		print_break("Resize / Assign / Swap / Operators");
+		ft_v1.resize(4, 8);
+		std_v1.resize(4, 8);
+		gap_vector_check(ft_v1, std_v1);
+		ft_v1.resize(2);
+		std_v1.resize(2);
+		gap_vector_check(ft_v1, std_v1);
+		ft_v2.assign(std_v3.begin(), std_v3.end());
+		gap_vector_check(ft_v2, std_v3);
+		ft::swap(ft_v1, ft_v2);
+		gap_vector_check(ft_v2, std_v1);
+		ft_v4 = ft_v1;
+		assert(ft_v4 == ft_v1 && ft_v4 <= ft_v1 && ft_v4 >= ft_v1);
+		ft_v4.push_back(1000);
+		assert(ft_v4 != ft_v1 && ft_v1 < ft_v4 && ft_v4 > ft_v1);
+		try
+		{
+			ft_v4.at(ft_v4.size());
+			assert(false);
+		}
+		catch (std::out_of_range &e)
+		{
+			std::cout << "Out of range caught\n" << std::endl;
+		}
+	}
+	{
+		clock_t start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		print_break("Performance");
+
+		ft::gap_vector<char>	ft_text(TEXT, 'x');
+		std::vector<char>		std_text(TEXT, 'x');
+		std::size_t				cursor = TEXT / 2;
+
+		srand(42);
+		start_time = clock();
+		for (int i = 0; i < EDITS; i++)
+		{
+			cursor += rand() % 5;
+			if (i % 4 == 3)
+				ft_text.erase(ft_text.begin() + cursor);
+			else
+				ft_text.insert(ft_text.begin() + cursor, 'a' + i % 26);
+		}
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		cursor = TEXT / 2;
+		srand(42);
+		start_time = clock();
+		for (int i = 0; i < EDITS; i++)
+		{
+			cursor += rand() % 5;
+			if (i % 4 == 3)
+				std_text.erase(std_text.begin() + cursor);
+			else
+				std_text.insert(std_text.begin() + cursor, 'a' + i % 26);
+		}
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		assert(ft_text.size() == std_text.size());
+		assert(std::equal(std_text.begin(), std_text.end(), ft_text.data()));
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Slower by: " << ft_elapsed_time / std_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Gap_vector OK");
+	}
+	return (0);
+}
@@ -0,0 +1,203 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:14:29 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:38:30 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/mapped_vector.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iterator>
+
+#define PATH		"/tmp/ft_mapped_vector.bin"
+#define RECORDS		4000000
+
+struct	Record
+{
+	int		id;
+	double	value;
+
+	bool	operator==(const Record& other) const { return (id == other.id && value == other.value); };
+};
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class T>
+void	mapped_vector_check(ft::mapped_vector<T> const &ft_vec, std::vector<T> const &std_vec)
+{
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	assert(ft_vec.capacity() >= ft_vec.size());
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		assert(ft_vec[i] == std_vec[i]);
+		assert(*(ft_vec.begin() + i) == std_vec[i]);
+	}
+	typename ft::mapped_vector<T>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	typename std::vector<T>::const_reverse_iterator			std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+}
+
+int	main(void)
+{
+	std::remove(PATH);
+	{
+		print_break("Modifiers");
+		ft::mapped_vector<int>	ft_v(PATH);
+		std::vector<int>		std_v;
+
+		mapped_vector_check(ft_v, std_v);
+		for (int i = 0; i < 5000; i++)
+		{
+			ft_v.push_back(i);
+			std_v.push_back(i);
+		}
+		ft_v.insert(ft_v.begin() + 3, 10, -1);
+		std_v.insert(std_v.begin() + 3, 10, -1);
+		std::vector<int>		range(std_v.begin() + 100, std_v.begin() + 200);
+		ft_v.insert(ft_v.begin(), range.begin(), range.end());
+		std_v.insert(std_v.begin(), range.begin(), range.end());
+		std::istringstream			in("7 8 9");
+		ft_v.insert(ft_v.begin() + 50, std::istream_iterator<int>(in), std::istream_iterator<int>());
+		std_v.insert(std_v.begin() + 50, 7);
+		std_v.insert(std_v.begin() + 51, 8);
+		std_v.insert(std_v.begin() + 52, 9);
+		assert(*ft_v.insert(ft_v.end() - 1, 42) == 42);
+		std_v.insert(std_v.end() - 1, 42);
+		mapped_vector_check(ft_v, std_v);
+		assert(ft_v.erase(ft_v.begin() + 7) == ft_v.begin() + 7);
+		std_v.erase(std_v.begin() + 7);
+		ft_v.erase(ft_v.begin() + 10, ft_v.begin() + 1000);
+		std_v.erase(std_v.begin() + 10, std_v.begin() + 1000);
+		ft_v.pop_back();
+		std_v.pop_back();
+		ft_v.resize(5000, 3);
+		std_v.resize(5000, 3);
+		mapped_vector_check(ft_v, std_v);
+		assert(ft_v.at(10) == std_v.at(10) && ft_v.front() == std_v.front() && ft_v.back() == std_v.back());
+		try
+		{
+			ft_v.at(5000);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		ft_v.shrink_to_fit();
+		assert(ft_v.capacity() == 5000);
+		ft_v.sync();
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Reopen");
+		ft::mapped_vector<int>	ft_v(PATH);
+		const ft::mapped_vector<int>	ft_ro(PATH, false);
+
+		assert(ft_v.size() == 5000 && ft_v.capacity() == 5000);
+		assert(ft_v == ft_ro);
+		ft_v[0] = 1234;
+		assert(ft_ro[0] == 1234);
+		try
+		{
+			ft::mapped_vector<int>	ro(PATH, false);
+			ro.push_back(1);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		{
+			ft::mapped_vector<int>			ro(PATH, false);
+			const ft::mapped_vector<int>&	ro_ref = ro;
+			int								thrown = 0;
+
+			assert(ro_ref[0] == 1234 && *ro_ref.begin() == 1234 && ro_ref.data() == &ro_ref.front());
+			try { ro[0] = 1; } catch (const std::runtime_error&) { thrown++; }
+			try { *ro.begin() = 1; } catch (const std::runtime_error&) { thrown++; }
+			try { *ro.rbegin() = 1; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.at(0) = 1; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.back() = 1; } catch (const std::runtime_error&) { thrown++; }
+			try { *ro.data() = 1; } catch (const std::runtime_error&) { thrown++; }
+			assert(thrown == 6 && ro_ref[0] == 1234);
+		}
+		try
+		{
+			ft::mapped_vector<Record>	wrong(PATH);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		try
+		{
+			ft::mapped_vector<int>	missing("/tmp/ft_mapped_vector_missing.bin", false);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	std::remove(PATH);
+	{
+		double	ft_elapsed_time, std_elapsed_time, start_time;
+		double	ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+		{
+			ft::mapped_vector<Record>	ft_v(PATH);
+			std::vector<Record>			std_v;
+			Record						r;
+
+			ft_v.reserve(RECORDS);
+			for (int i = 0; i < RECORDS; i++)
+			{
+				r.id = i;
+				r.value = i * 0.5;
+				ft_v.push_back(r);
+			}
+		}
+		std::cout << "Reopening " << RECORDS << " records and reading every 1024th" << std::endl;
+		start_time = wall_time();
+		{
+			const ft::mapped_vector<Record>	ft_v(PATH, false);
+			for (std::size_t i = 0; i < ft_v.size(); i += 1024)
+				ft_sum += ft_v[i].value;
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		{
+			std::FILE			*file = std::fopen(PATH, "rb");
+			std::vector<Record>	std_v(RECORDS);
+			assert(file != NULL);
+			assert(std::fseek(file, 64, SEEK_SET) == 0);
+			assert(std::fread(&std_v[0], sizeof(Record), RECORDS, file) == RECORDS);
+			std::fclose(file);
+			for (std::size_t i = 0; i < std_v.size(); i += 1024)
+				std_sum += std_v[i].value;
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std (fread) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Mapped_vector OK");
+	}
+	std::remove(PATH);
+	return (0);
+}
@@ -0,0 +1,242 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mpmc_queue.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:17 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:27 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/mpmc_queue.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <queue>
+#include <pthread.h>
+#include <sched.h>
+
+#define THREADS	4
+#define ITEMS	200000
+#define BATCH	32
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Shared state of the producer and consumer threads */
+struct	shared_queue
+{
+	shared_queue() : queue(1024), sum(0), count(0) { pthread_mutex_init(&lock, NULL); };
+	~shared_queue() { pthread_mutex_destroy(&lock); };
+
+	ft::mpmc_queue<long>	queue;
+	std::queue<long>		baseline;
+	long					sum;
+	long					count;
+	bool					batch;
+	pthread_mutex_t			lock;
+};
+
+void	*producer(void *arg)
+{
+	shared_queue		*shared = static_cast<shared_queue *>(arg);
+	std::vector<long>	batch(BATCH);
+
+	for (long i = 1; i <= ITEMS; i += BATCH)
+	{
+		for (long j = 0; j < BATCH; j++)
+			batch[j] = i + j;
+		if (shared->batch)
+		{
+			std::vector<long>::iterator	it = batch.begin();
+			while ((it = shared->queue.push_range(it, batch.end())) != batch.end())
+				sched_yield();
+		}
+		else
+			for (long j = 0; j < BATCH; j++)
+				while (shared->queue.try_push(batch[j]) == false)
+					sched_yield();
+	}
+	return (NULL);
+}
+
+void	*consumer(void *arg)
+{
+	shared_queue		*shared = static_cast<shared_queue *>(arg);
+	std::vector<long>	out(BATCH);
+	long				sum = 0;
+	long				count = 0;
+	long				value;
+
+	while (count < ITEMS)
+	{
+		if (shared->batch)
+		{
+			ft::mpmc_queue<long>::size_type	n = shared->queue.pop_range(out.begin(), std::min<long>(BATCH, ITEMS - count));
+			for (ft::mpmc_queue<long>::size_type i = 0; i < n; i++)
+				sum += out[i];
+			count += n;
+			if (n == 0)
+				sched_yield();
+		}
+		else if (shared->queue.try_pop(value))
+		{
+			sum += value;
+			count++;
+		}
+		else
+			sched_yield();
+	}
+	pthread_mutex_lock(&shared->lock);
+	shared->sum += sum;
+	shared->count += count;
+	pthread_mutex_unlock(&shared->lock);
+	return (NULL);
+}
+
+void	*locked_producer(void *arg)
+{
+	shared_queue	*shared = static_cast<shared_queue *>(arg);
+
+	for (long i = 1; i <= ITEMS; i++)
+	{
+		pthread_mutex_lock(&shared->lock);
+		shared->baseline.push(i);
+		pthread_mutex_unlock(&shared->lock);
+	}
+	return (NULL);
+}
+
+void	*locked_consumer(void *arg)
+{
+	shared_queue	*shared = static_cast<shared_queue *>(arg);
+	long			count = 0;
+
+	while (count < ITEMS)
+	{
+		pthread_mutex_lock(&shared->lock);
+		if (shared->baseline.empty() == false)
+		{
+			shared->sum += shared->baseline.front();
+			shared->baseline.pop();
+			count++;
+			pthread_mutex_unlock(&shared->lock);
+		}
+		else
+		{
+			pthread_mutex_unlock(&shared->lock);
+			sched_yield();
+		}
+	}
+	pthread_mutex_lock(&shared->lock);
+	shared->count += count;
+	pthread_mutex_unlock(&shared->lock);
+	return (NULL);
+}
+
+double	run_threads(void *(*produce)(void *), void *(*consume)(void *), shared_queue& shared)
+{
+	pthread_t	threads[THREADS * 2];
+	double		start_time = wall_time();
+
+	for (int i = 0; i < THREADS; i++)
+	{
+		pthread_create(&threads[i * 2], NULL, produce, &shared);
+		pthread_create(&threads[i * 2 + 1], NULL, consume, &shared);
+	}
+	for (int i = 0; i < THREADS * 2; i++)
+		pthread_join(threads[i], NULL);
+	assert(shared.count == (long)THREADS * ITEMS);
+	assert(shared.sum == (long)THREADS * ITEMS * (ITEMS + 1) / 2);
+	return (wall_time() - start_time);
+}
+
+int	main(void)
+{
+	{
+		print_break("Try_push / Try_pop");
+		ft::mpmc_queue<std::string>	q(3);
+		std::string					value;
+
+		assert(q.capacity() == 4);
+		assert(q.empty());
+		assert(q.try_pop(value) == false);
+		for (int i = 0; i < 4; i++)
+			assert(q.try_push(std::string(1, 'a' + i)));
+		assert(q.try_push("e") == false);
+		assert(q.size() == 4);
+		for (int round = 0; round < 10; round++)
+		{
+			assert(q.try_pop(value));
+			assert(q.try_push(value));
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			assert(q.try_pop(value));
+			assert(value == std::string(1, 'a' + (i + 10) % 4));
+		}
+		assert(q.empty());
+		q.try_push("left over");
+		try
+		{
+			ft::mpmc_queue<std::string>	q2(q.max_size() + 1);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Push_range / Pop_range");
+		ft::mpmc_queue<int>	q(8);
+		std::vector<int>	in;
+		std::vector<int>	out;
+
+		for (int i = 0; i < 12; i++)
+			in.push_back(i);
+		std::vector<int>::iterator	it = q.push_range(in.begin(), in.end());
+		assert(it == in.begin() + 8);
+		assert(q.size() == 8);
+		assert(q.pop_range(std::back_inserter(out), 5) == 5);
+		it = q.push_range(it, in.end());
+		assert(it == in.end());
+		assert(q.pop_range(std::back_inserter(out), 100) == 7);
+		assert(out == in);
+		assert(q.pop_range(std::back_inserter(out), 100) == 0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double	single_elapsed_time, batch_elapsed_time, locked_elapsed_time;
+		print_break("Performance");
+
+		shared_queue	single;
+		single.batch = false;
+		single_elapsed_time = run_threads(producer, consumer, single);
+		std::cout << "ft::mpmc_queue elapsed time: " << std::fixed << std::setprecision(6) << single_elapsed_time << " seconds" << std::endl;
+
+		shared_queue	batch;
+		batch.batch = true;
+		batch_elapsed_time = run_threads(producer, consumer, batch);
+		std::cout << "ft::mpmc_queue (batch) elapsed time: " << std::fixed << std::setprecision(6) << batch_elapsed_time << " seconds" << std::endl;
+
+		shared_queue	locked;
+		locked_elapsed_time = run_threads(locked_producer, locked_consumer, locked);
+		std::cout << "mutex + std::queue elapsed time: " << std::fixed << std::setprecision(6) << locked_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << locked_elapsed_time / single_elapsed_time << "x times (" << locked_elapsed_time / batch_elapsed_time << "x with batches)\n" << std::endl;
+		print_break("All test finished: Mpmc_queue OK");
+	}
+	return (0);
+}
@@ -0,0 +1,292 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:57:41 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:30 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/multimap.hpp"
+#include "../srcs/multiset.hpp"
+#include "../srcs/map.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define ENTRIES		1000000
+#define KEYS		50000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Checks the elements, their order among equal keys included, and every lookup of keys in [0, keys] */
+template <class Key, class T>
+void	multimap_check(ft::multimap<Key, T> const &ft_m, std::multimap<Key, T> const &std_m, Key keys)
+{
+	tree_check(ft_m);
+	assert(ft_m.size() == std_m.size());
+	typename std::multimap<Key, T>::const_iterator	std_it = std_m.begin();
+	for (typename ft::multimap<Key, T>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it, ++std_it)
+		assert(it->first == std_it->first && it->second == std_it->second);
+	typename std::multimap<Key, T>::const_reverse_iterator	std_rit = std_m.rbegin();
+	for (typename ft::multimap<Key, T>::const_reverse_iterator it = ft_m.rbegin(); it != ft_m.rend(); ++it, ++std_rit)
+		assert(it->second == std_rit->second);
+	for (Key key = 0; key <= keys; key++)
+	{
+		assert(ft_m.count(key) == std_m.count(key));
+		assert(std::distance(ft_m.begin(), ft_m.lower_bound(key)) == std::distance(std_m.begin(), std_m.lower_bound(key)));
+		assert(std::distance(ft_m.begin(), ft_m.upper_bound(key)) == std::distance(std_m.begin(), std_m.upper_bound(key)));
+		assert(ft_m.equal_range(key).first == ft_m.lower_bound(key) && ft_m.equal_range(key).second == ft_m.upper_bound(key));
+		assert((ft_m.find(key) == ft_m.end()) == (std_m.count(key) == 0));
+		if (ft_m.find(key) != ft_m.end())
+			assert(ft_m.find(key)->first == key);
+	}
+}
+
+template <class Key>
+void	multiset_check(ft::multiset<Key> const &ft_s, std::multiset<Key> const &std_s)
+{
+	tree_check(ft_s);
+	assert(ft_s.size() == std_s.size());
+	assert(std::equal(std_s.begin(), std_s.end(), ft_s.begin()));
+	assert(std::equal(std_s.rbegin(), std_s.rend(), ft_s.rbegin()));
+	for (typename std::multiset<Key>::const_iterator it = std_s.begin(); it != std_s.end(); it = std_s.upper_bound(*it))
+		assert(ft_s.count(*it) == std_s.count(*it));
+}
+
+/* Selects the values of one parity */
+struct	odd_value
+{
+	bool	operator()(ft::pair<const int, int> const &value) const { return (value.second % 2 == 1); };
+};
+
+int	main(void)
+{
+	{
+		print_break("Multimap");
+		ft::multimap<int, int>	ft_m;
+		std::multimap<int, int>	std_m;
+		int						serial = 0;
+		srand(42);
+		for (int round = 0; round < 6000; round++)
+		{
+			int	key = rand() % 60;
+			int	op = rand() % 10;
+
+			if (op < 4)
+			{
+				assert(ft_m.insert(ft::make_pair(key, serial))->second == serial);
+				std_m.insert(std::make_pair(key, serial++));
+			}
+			else if (op < 7)
+			{
+				ft::multimap<int, int>::iterator	hint = ft_m.begin();
+				if (op == 4)
+					hint = ft_m.upper_bound(key);
+				else if (op == 5 && ft_m.empty() == false)
+					std::advance(hint, rand() % ft_m.size());
+				else
+					hint = ft_m.end();
+				assert(ft_m.insert(hint, ft::make_pair(key, serial))->second == serial);
+				std_m.insert(std::make_pair(key, serial++));
+			}
+			else if (op < 9 && ft_m.empty() == false)
+			{
+				ft::multimap<int, int>::iterator	it = ft_m.begin();
+				std::multimap<int, int>::iterator	std_it = std_m.begin();
+				int									n = rand() % ft_m.size();
+				std::advance(it, n);
+				std::advance(std_it, n);
+				ft_m.erase(it);
+				std_m.erase(std_it);
+			}
+			else if (round % 7 == 0)
+				assert(ft_m.erase(key) == std_m.erase(key));
+			if (round % 500 == 0)
+				multimap_check(ft_m, std_m, 60);
+		}
+		multimap_check(ft_m, std_m, 60);
+
+		ft::multimap<int, int>	ft_copy(ft_m);
+		assert(ft_copy == ft_m);
+		ft_copy.compact();
+		multimap_check(ft_copy, std_m, 60);
+		ft_copy.insert(ft::make_pair(30, -1));
+		assert(ft_copy != ft_m && (ft_m < ft_copy) != (ft_copy < ft_m) && ft_m <= ft_m);
+
+		ft::multimap<int, int>::iterator	first = ft_m.begin();
+		std::multimap<int, int>::iterator	std_first = std_m.begin();
+		std::advance(first, ft_m.size() / 4);
+		std::advance(std_first, std_m.size() / 4);
+		ft::multimap<int, int>::iterator	last = first;
+		std::multimap<int, int>::iterator	std_last = std_first;
+		std::advance(last, ft_m.size() / 2);
+		std::advance(std_last, std_m.size() / 2);
+		ft_m.erase(first, last);
+		std_m.erase(std_first, std_last);
+		multimap_check(ft_m, std_m, 60);
+
+		assert(ft::erase_if(ft_m, odd_value(), 0.0) > 0);
+		for (std::multimap<int, int>::iterator it = std_m.begin(); it != std_m.end();)
+		{
+			if (it->second % 2 == 1)
+				std_m.erase(it++);
+			else
+				++it;
+		}
+		multimap_check(ft_m, std_m, 60);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Multimap node handles");
+		ft::multimap<int, std::string>	ft_a, ft_b;
+		std::multimap<int, std::string>	std_a, std_b;
+		ft::map<int, std::string>		ft_unique;
+		for (int i = 0; i < 300; i++)
+		{
+			ft_a.insert(ft::make_pair(i % 20, std::string(1, 'a' + i % 26)));
+			std_a.insert(std::make_pair(i % 20, std::string(1, 'a' + i % 26)));
+			ft_b.insert(ft::make_pair(i % 30, std::string(2, 'a' + i % 26)));
+			std_b.insert(std::make_pair(i % 30, std::string(2, 'a' + i % 26)));
+		}
+		ft::multimap<int, std::string>::node_type	nh = ft_a.extract(7);
+		assert(nh.empty() == false && nh.key() == 7 && nh.mapped() == std_a.find(7)->second);
+		std_b.insert(*std_a.find(7));
+		std_a.erase(std_a.find(7));
+		ft::multimap<int, std::string>::iterator	it = ft_b.insert(nh);
+		assert(nh.empty() && it->first == 7 && ++it == ft_b.upper_bound(7));
+		assert(ft_a.extract(99).empty());
+
+		ft_unique[5] = "unique";
+		ft_b.insert(ft_unique.extract(5));
+		std_b.insert(std::make_pair(5, std::string("unique")));
+		ft_unique.insert(ft_b.extract(ft_b.begin()));
+		assert(ft_unique.size() == 1 && ft_unique.begin()->first == std_b.begin()->first);
+		std_b.erase(std_b.begin());
+
+		ft_a.merge(ft_b);
+		std_a.insert(std_b.begin(), std_b.end());
+		std_b.clear();
+		assert(ft_b.empty());
+		multimap_check(ft_a, std_a, 40);
+		ft_b.merge(ft_a);
+		assert(ft_a.empty());
+		multimap_check(ft_b, std_a, 40);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Multiset");
+		ft::multiset<int>		ft_s;
+		std::multiset<int>		std_s;
+		std::vector<int>		values;
+		srand(21);
+		for (int i = 0; i < 5000; i++)
+			values.push_back(rand() % 300);
+		ft_s.insert(values.begin(), values.end());
+		std_s.insert(values.begin(), values.end());
+		multiset_check(ft_s, std_s);
+		for (int key = 0; key < 300; key += 3)
+			assert(ft_s.erase(key) == std_s.erase(key));
+		multiset_check(ft_s, std_s);
+
+		ft::multiset<int>	ft_sorted(std_s.begin(), std_s.end());
+		std::multiset<int>	std_all(std_s);
+		multiset_check(ft_sorted, std_s);
+		ft_sorted.compact();
+		ft::multiset<int>::node_type	nh = ft_sorted.extract(1);
+		assert(nh.empty() == false && nh.value() == 1);
+		nh.value() = 1000;
+		ft_sorted.insert(ft_sorted.end(), nh);
+		std_s.erase(std_s.find(1));
+		std_s.insert(1000);
+		multiset_check(ft_sorted, std_s);
+		ft_s.merge(ft_sorted);
+		std_all.insert(std_s.begin(), std_s.end());
+		assert(ft_sorted.empty());
+		multiset_check(ft_s, std_all);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double									ft_elapsed_time, std_elapsed_time, start_time;
+		std::vector<int>						keys;
+		long									ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+			keys.push_back(rand() % KEYS);
+		std::cout << "Inserting " << ENTRIES << " entries under " << KEYS << " keys and reading every key's run" << std::endl;
+
+		start_time = wall_time();
+		{
+			ft::multimap<int, int>	ft_m;
+			for (int i = 0; i < ENTRIES; i++)
+				ft_m.insert(ft::make_pair(keys[i], i));
+			for (int key = 0; key < KEYS; key++)
+			{
+				ft::pair<ft::multimap<int, int>::iterator, ft::multimap<int, int>::iterator>	range = ft_m.equal_range(key);
+				for (; range.first != range.second; ++range.first)
+					ft_sum += range.first->second;
+			}
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (multimap) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		{
+			std::multimap<int, int>	std_m;
+			for (int i = 0; i < ENTRIES; i++)
+				std_m.insert(std::make_pair(keys[i], i));
+			for (int key = 0; key < KEYS; key++)
+			{
+				std::pair<std::multimap<int, int>::iterator, std::multimap<int, int>::iterator>	range = std_m.equal_range(key);
+				for (; range.first != range.second; ++range.first)
+					std_sum += range.first->second;
+			}
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std (multimap) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		std::cout << "Appending runs of 20 equal keys with the hint after the last one" << std::endl;
+		ft::multimap<int, int>	ft_hinted, ft_plain;
+		start_time = wall_time();
+		for (int i = 0; i < ENTRIES / 20; i++)
+			for (int j = 0; j < 20; j++)
+				ft_plain.insert(ft::make_pair(keys[i], j));
+		std_elapsed_time = wall_time() - start_time;
+
+		start_time = wall_time();
+		for (int i = 0; i < ENTRIES / 20; i++)
+		{
+			ft::multimap<int, int>::iterator	pos = ft_hinted.insert(ft::make_pair(keys[i], 0));
+			for (int j = 1; j < 20; j++)
+				pos = ft_hinted.insert(++pos, ft::make_pair(keys[i], j));
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (hinted insert) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+		std::cout << "ft (insert) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_hinted == ft_plain);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Multimap OK");
+	}
+	return (0);
+}
@@ -0,0 +1,313 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:08:47 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:33 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define ENTRIES		500000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Number of allocate() calls made through counting_allocator */
+size_t	g_allocations = 0;
+
+/* Std::allocator that counts its allocations */
+template <class T>
+class counting_allocator : public std::allocator<T>
+{
+	public:
+		template <class U>
+		struct	rebind
+		{
+			typedef counting_allocator<U>	other;
+		};
+
+		counting_allocator() : std::allocator<T>() {};
+		counting_allocator(const counting_allocator& other) : std::allocator<T>(other) {};
+		template <class U>
+		counting_allocator(const counting_allocator<U>& other) : std::allocator<T>(other) {}
+
+		T	*allocate(size_t n, const void *hint = 0)
+		{
+			(void)hint;
+			g_allocations++;
+			return (std::allocator<T>::allocate(n));
+		};
+};
+
+template <class FtMap, class StdMap>
+void	map_check(FtMap const &ft_m, StdMap const &std_m)
+{
+	tree_check(ft_m);
+	assert(ft_m.size() == std_m.size());
+	typename StdMap::const_iterator	std_it = std_m.begin();
+	for (typename FtMap::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it, ++std_it)
+		assert(it->first == std_it->first && it->second == std_it->second);
+	typename StdMap::const_reverse_iterator	std_rit = std_m.rbegin();
+	for (typename FtMap::const_reverse_iterator it = ft_m.rbegin(); it != ft_m.rend(); ++it, ++std_rit)
+		assert(it->first == std_rit->first);
+}
+
+template <class Key>
+void	set_check(ft::set<Key> const &ft_s, std::set<Key> const &std_s)
+{
+	tree_check(ft_s);
+	assert(ft_s.size() == std_s.size());
+	assert(std::equal(std_s.begin(), std_s.end(), ft_s.begin()));
+	assert(std::equal(std_s.rbegin(), std_s.rend(), ft_s.rbegin()));
+}
+
+int	main(void)
+{
+	{
+		print_break("Map extract and insert");
+		typedef ft::map<int, std::string, std::less<int>, counting_allocator<ft::pair<const int, std::string> > >	map_type;
+		map_type					ft_hot, ft_cold;
+		std::map<int, std::string>	std_hot, std_cold;
+		srand(42);
+		for (int i = 0; i < 2000; i++)
+		{
+			int	key = rand() % 5000;
+			ft_hot[key] = std::string(key % 7 + 20, 'a' + key % 26);
+			std_hot[key] = ft_hot[key];
+		}
+		size_t	allocations = g_allocations;
+		for (int round = 0; round < 3000; round++)
+		{
+			int	key = rand() % 5000;
+			if (ft_hot.count(key) == 0)
+			{
+				assert(ft_hot.extract(key).empty());
+				continue ;
+			}
+			const std::string	*element = &ft_hot.find(key)->second;
+			map_type::node_type	nh = (round % 2 == 0 ? ft_hot.extract(key) : ft_hot.extract(ft_hot.find(key)));
+			assert(nh.empty() == false && nh.key() == key && &nh.mapped() == element);
+			map_type::insert_return_type	result = ft_cold.insert(nh);
+			assert(nh.empty() && result.node.empty() == (result.inserted == true));
+			assert(result.position->first == key && ft_cold.find(key) == result.position);
+			if (result.inserted)
+				assert(&result.position->second == element);
+			else
+				assert(result.node.key() == key);
+			std_cold.insert(*std_hot.find(key));
+			std_hot.erase(key);
+		}
+		assert(g_allocations == allocations);
+		map_check(ft_hot, std_hot);
+		map_check(ft_cold, std_cold);
+
+		map_type::node_type	nh = ft_cold.extract(ft_cold.begin());
+		int					key = nh.key();
+		nh.key() = -1;
+		nh.mapped() = "renamed";
+		map_type::iterator	it = ft_hot.insert(ft_hot.begin(), nh);
+		assert(nh.empty() && it == ft_hot.begin() && it->first == -1 && it->second == "renamed");
+		std_cold.erase(key);
+		std_hot[-1] = "renamed";
+		map_check(ft_hot, std_hot);
+		map_check(ft_cold, std_cold);
+		nh = ft_cold.extract(ft_cold.begin());
+		key = nh.key();
+		nh.key() = -1;
+		assert(ft_hot.insert(ft_hot.end(), nh) == ft_hot.begin() && nh.empty() == false && nh.key() == -1);
+		nh.key() = key;
+		assert(ft_cold.insert(ft_cold.end(), nh)->first == key && nh.empty());
+		map_check(ft_hot, std_hot);
+		map_check(ft_cold, std_cold);
+		key = ft_cold.begin()->first;
+		assert(ft_hot.insert(ft_hot.end(), ft_cold.extract(key))->first == key);
+		std_hot.insert(*std_cold.find(key));
+		std_cold.erase(key);
+		map_check(ft_hot, std_hot);
+		map_check(ft_cold, std_cold);
+		assert(g_allocations == allocations);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Map merge");
+		typedef ft::map<int, std::string, std::less<int>, counting_allocator<ft::pair<const int, std::string> > >	map_type;
+		srand(7);
+		for (int round = 0; round < 60; round++)
+		{
+			map_type					ft_a, ft_b;
+			std::map<int, std::string>	std_a, std_b;
+			std::vector<const std::string *>	elements;
+			int							range = (round % 3 == 0 ? 100000 : 600);
+
+			for (int i = rand() % 400; i > 0; i--)
+			{
+				int	key = rand() % range;
+				ft_a[key] = "a";
+				std_a[key] = "a";
+			}
+			for (int i = rand() % 400; i > 0; i--)
+			{
+				int	key = rand() % range + (round % 4 == 0 ? range : 0);
+				ft_b[key] = "b";
+				std_b[key] = "b";
+			}
+			for (map_type::iterator it = ft_b.begin(); it != ft_b.end(); ++it)
+				if (ft_a.count(it->first) == 0)
+					elements.push_back(&it->second);
+			size_t	allocations = g_allocations;
+			ft_a.merge(ft_b);
+			assert(g_allocations == allocations);
+			for (std::map<int, std::string>::iterator it = std_b.begin(); it != std_b.end();)
+			{
+				if (std_a.insert(*it).second)
+					std_b.erase(it++);
+				else
+					++it;
+			}
+			map_check(ft_a, std_a);
+			map_check(ft_b, std_b);
+			for (size_t i = 0; i < elements.size(); i++)
+				assert(*elements[i] == "b");
+			ft_a.merge(ft_a);
+			map_check(ft_a, std_a);
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		ft::set<int>	ft_a, ft_b;
+		std::set<int>	std_a, std_b;
+		srand(21);
+		for (int i = 0; i < 3000; i++)
+		{
+			int	key = rand() % 4000;
+			ft_a.insert(key);
+			std_a.insert(key);
+			key = rand() % 4000;
+			ft_b.insert(key);
+			std_b.insert(key);
+		}
+		ft_b.compact();
+		for (int i = 0; i < 1000; i++)
+		{
+			int	key = rand() % 4000;
+			ft::set<int>::node_type	nh = ft_b.extract(key);
+			assert(nh.empty() == (std_b.count(key) == 0));
+			if (nh.empty())
+				continue ;
+			nh.value() = key + 4000;
+			assert(ft_a.insert(nh).inserted && nh.empty());
+			std_b.erase(key);
+			std_a.insert(key + 4000);
+		}
+		set_check(ft_a, std_a);
+		set_check(ft_b, std_b);
+		ft::set<int>::node_type	nh = ft_a.extract(ft_a.begin());
+		int						key = nh.value();
+		nh.value() = *ft_a.rbegin();
+		assert(*ft_a.insert(ft_a.end(), nh) == *ft_a.rbegin() && nh.empty() == false);
+		nh.value() = key;
+		assert(*ft_a.insert(ft_a.begin(), nh) == key && nh.empty());
+		set_check(ft_a, std_a);
+		key = *ft_b.rbegin();
+		assert(*ft_a.insert(ft_a.end(), ft_b.extract(key)) == key);
+		std_a.insert(key);
+		std_b.erase(key);
+		set_check(ft_a, std_a);
+		set_check(ft_b, std_b);
+		ft_a.merge(ft_b);
+		for (std::set<int>::iterator it = std_b.begin(); it != std_b.end();)
+		{
+			if (std_a.insert(*it).second)
+				std_b.erase(it++);
+			else
+				++it;
+		}
+		set_check(ft_a, std_a);
+		set_check(ft_b, std_b);
+		ft_b.merge(ft_a);
+		set_check(ft_b, std_a);
+		assert(ft_a.size() == std_b.size());
+		for (ft::set<int>::iterator it = ft_a.begin(); it != ft_a.end(); ++it)
+			assert(std_b.count(*it) == 1);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double							ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, std::string>		ft_hot, ft_cold, copy_hot, copy_cold;
+		std::vector<int>				keys;
+		print_break("Performance");
+		srand(3);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			int			key = rand();
+			std::string	value(40 + key % 20, 'a' + key % 26);
+
+			ft_hot[key] = value;
+			copy_hot[key] = value;
+			if (i % 2 == 0)
+				keys.push_back(key);
+		}
+		std::cout << "Moving " << keys.size() << " of " << ft_hot.size() << " entries to another map" << std::endl;
+
+		start_time = wall_time();
+		for (size_t i = 0; i < keys.size(); i++)
+			ft_cold.insert(ft_hot.extract(keys[i]));
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (extract and insert) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (size_t i = 0; i < keys.size(); i++)
+		{
+			ft::map<int, std::string>::iterator	it = copy_hot.find(keys[i]);
+			if (it == copy_hot.end())
+				continue ;
+			copy_cold.insert(*it);
+			copy_hot.erase(it);
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (copy and erase) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_hot == copy_hot && ft_cold == copy_cold);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		std::cout << "Merging " << ft_cold.size() << " entries back" << std::endl;
+		start_time = wall_time();
+		ft_hot.merge(ft_cold);
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (merge) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		copy_hot.insert(copy_cold.begin(), copy_cold.end());
+		copy_cold.clear();
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (insert range and clear) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_hot == copy_hot && ft_cold.empty());
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Node_handle OK");
+	}
+	return (0);
+}
@@ -0,0 +1,210 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:02:37 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:39:19 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/persistent_map.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <map>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define PATH		"/tmp/ft_persistent_map.bin"
+#define ENTRIES		1000000
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class Key, class T>
+void	persistent_map_check(ft::persistent_map<Key, T> const &ft_map, std::map<Key, T> const &std_map)
+{
+	assert(ft_map.empty() == std_map.empty());
+	assert(ft_map.size() == std_map.size());
+	typename ft::persistent_map<Key, T>::const_iterator	ft_it = ft_map.begin();
+	typename std::map<Key, T>::const_iterator			std_it = std_map.begin();
+	for (; std_it != std_map.end(); ft_it++, std_it++)
+		assert(ft_it->first == std_it->first && ft_it->second == std_it->second);
+	assert(ft_it == ft_map.end());
+	typename ft::persistent_map<Key, T>::const_reverse_iterator	ft_rit = ft_map.rbegin();
+	typename std::map<Key, T>::const_reverse_iterator			std_rit = std_map.rbegin();
+	for (; std_rit != std_map.rend(); ft_rit++, std_rit++)
+		assert(ft_rit->first == std_rit->first);
+	assert(ft_rit == ft_map.rend());
+}
+
+int	main(void)
+{
+	std::remove(PATH);
+	{
+		print_break("Modifiers");
+		ft::persistent_map<int, double>	ft_m(PATH);
+		std::map<int, double>			std_m;
+
+		persistent_map_check(ft_m, std_m);
+		srand(42);
+		for (int i = 0; i < 20000; i++)
+		{
+			int	key = rand() % 10000;
+			assert(ft_m.insert(ft::make_pair(key, key * 0.5)).second == std_m.insert(std::make_pair(key, key * 0.5)).second);
+		}
+		persistent_map_check(ft_m, std_m);
+		for (int i = 0; i < 5000; i++)
+		{
+			int	key = rand() % 10000;
+			assert(ft_m.erase(key) == std_m.erase(key));
+		}
+		persistent_map_check(ft_m, std_m);
+		ft_m[-1] = 3.5;
+		std_m[-1] = 3.5;
+		ft_m.erase(ft_m.begin());
+		std_m.erase(std_m.begin());
+		ft_m.erase(ft_m.find(100), ft_m.lower_bound(200));
+		std_m.erase(std_m.find(100), std_m.lower_bound(200));
+		assert(ft_m.insert(ft_m.end(), ft::make_pair(150, 1.0))->second == 1.0);
+		std_m.insert(std_m.end(), std::make_pair(150, 1.0));
+		for (int i = 0; i < 1000; i += 7)
+		{
+			assert(ft_m.count(i) == std_m.count(i));
+			assert((ft_m.lower_bound(i) == ft_m.end()) == (std_m.lower_bound(i) == std_m.end()));
+			assert((ft_m.upper_bound(i) == ft_m.end()) == (std_m.upper_bound(i) == std_m.end()));
+			if (ft_m.lower_bound(i) != ft_m.end())
+				assert(ft_m.lower_bound(i)->first == std_m.lower_bound(i)->first);
+			if (ft_m.upper_bound(i) != ft_m.end())
+				assert(ft_m.upper_bound(i)->first == std_m.upper_bound(i)->first);
+		}
+		persistent_map_check(ft_m, std_m);
+		assert(ft_m.at(150) == std_m.at(150));
+		try
+		{
+			ft_m.at(-5);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		ft_m.sync();
+		std::cout << "OK\n" << std::endl;
+
+		print_break("Reopen");
+		{
+			ft::persistent_map<int, double>	reopened(PATH);
+
+			persistent_map_check(reopened, std_m);
+			reopened[123456] = 7.0;
+			std_m[123456] = 7.0;
+		}
+		{
+			const ft::persistent_map<int, double>	ro1(PATH, false);
+			const ft::persistent_map<int, double>	ro2(PATH, false);
+
+			persistent_map_check(ro1, std_m);
+			assert(ro1.find(123456) != ro1.end() && &*ro1.find(123456) != &*ro2.find(123456));
+			assert(ro2.find(123456)->second == 7.0);
+		}
+		pid_t	pid = fork();
+		if (pid == 0)
+		{
+			const ft::persistent_map<int, double>	ro(PATH, false);
+			std::exit(ro.size() == std_m.size() && ro.find(123456)->second == 7.0 ? 0 : 1);
+		}
+		int	status;
+		waitpid(pid, &status, 0);
+		assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+		try
+		{
+			ft::persistent_map<int, double>	ro(PATH, false);
+			ro[1] = 1.0;
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		{
+			ft::persistent_map<int, double>			ro(PATH, false);
+			const ft::persistent_map<int, double>&	ro_ref = ro;
+			int										thrown = 0;
+
+			assert(ro_ref.at(123456) == 7.0 && ro_ref.begin()->first == std_m.begin()->first);
+			try { ro.find(123456)->second = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.at(123456) = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.begin()->second = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.rbegin()->second = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.lower_bound(123456)->second = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			try { ro.equal_range(123456).first->second = 1.0; } catch (const std::runtime_error&) { thrown++; }
+			assert(thrown == 6 && ro_ref.at(123456) == 7.0);
+		}
+		try
+		{
+			ft::persistent_map<int, char>	wrong(PATH);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		try
+		{
+			ft::persistent_map<int, double>	missing("/tmp/ft_persistent_map_missing.bin", false);
+			assert(false);
+		}
+		catch(const std::exception& e) { std::cerr << e.what() << "\n\n"; }
+		ft_m.clear();
+		assert(ft_m.empty() && ft_m.begin() == ft_m.end());
+		std::cout << "OK\n" << std::endl;
+	}
+	std::remove(PATH);
+	{
+		double				ft_elapsed_time, std_elapsed_time, start_time;
+		double				ft_sum = 0, std_sum = 0;
+		std::vector<int>	keys;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+			keys.push_back(rand());
+		{
+			ft::persistent_map<int, double>	ft_m(PATH);
+			for (int i = 0; i < ENTRIES; i++)
+				ft_m[keys[i]] = i;
+		}
+		std::cout << "Reopening " << ENTRIES << " entries and looking up 1000 keys" << std::endl;
+		start_time = wall_time();
+		{
+			const ft::persistent_map<int, double>	ft_m(PATH, false);
+			for (int i = 0; i < ENTRIES; i += ENTRIES / 1000)
+				ft_sum += ft_m.find(keys[i])->second;
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		{
+			std::map<int, double>	std_m;
+			for (int i = 0; i < ENTRIES; i++)
+				std_m[keys[i]] = i;
+			for (int i = 0; i < ENTRIES; i += ENTRIES / 1000)
+				std_sum += std_m.find(keys[i])->second;
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std (rebuild) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Persistent_map OK");
+	}
+	std::remove(PATH);
+	return (0);
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:36 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:36 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/priority_queue.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <queue>
+#include <vector>
+#include <deque>
+
+#define TIMERS	1000000
+
+template <class T, class C, class Cmp, std::size_t D>
+void	ft_priority_queue_print(ft::priority_queue<T, C, Cmp, D> const &q)
+{
+	std::cout << "Size: " << q.size() << std::endl;
+	std::cout << "Content: " << std::endl;
+	for (ft::priority_queue<T, C, Cmp, D> temp = q; temp.empty() == false; temp.pop())
+		std::cout << temp.top() << " ";
+	std::cout << "\n" << std::endl;
+}
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class T, class C, class Cmp, std::size_t D, class StdQ>
+void	priority_queue_check(ft::priority_queue<T, C, Cmp, D> const &ft_q, StdQ const &std_q)
+{
+	ft::priority_queue<T, C, Cmp, D>	ft_temp = ft_q;
+	StdQ								std_temp = std_q;
+	ft_priority_queue_print(ft_q);
+	assert(ft_q.empty() == std_q.empty());
+	assert(ft_q.size() == std_q.size());
+	for (; std_temp.empty() == false; std_temp.pop(), ft_temp.pop())
+		assert(ft_temp.top() == std_temp.top());
+	assert(ft_temp.empty());
+}
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		std::vector<int>						values;
+		for (int i = 0; i < 20; i++)
+			values.push_back((i * 7919) % 23);
+
+		ft::priority_queue<int>					ft_q1;
+		ft::priority_queue<int>					ft_q2(values.begin(), values.end());
+		ft::priority_queue<int>					ft_q3(ft_q2);
+		ft::vector<int>							ft_cont(values.begin(), values.end());
+		ft::priority_queue<int>					ft_q4(std::less<int>(), ft_cont);
+		ft::priority_queue<int, ft::vector<int>, std::greater<int> >	ft_q5(values.begin(), values.end());
+		ft::priority_queue<int, std::deque<int>, std::less<int>, 2>	ft_q6(values.begin(), values.end());
+
+		std::priority_queue<int>				std_q1;
+		std::priority_queue<int>				std_q2(values.begin(), values.end());
+		std::priority_queue<int>				std_q3(std_q2);
+		std::priority_queue<int, std::vector<int>, std::greater<int> >	std_q5(values.begin(), values.end());
+
+		priority_queue_check(ft_q1, std_q1);
+		priority_queue_check(ft_q2, std_q2);
+		priority_queue_check(ft_q3, std_q3);
+		priority_queue_check(ft_q4, std_q2);
+		priority_queue_check(ft_q5, std_q5);
+		priority_queue_check(ft_q6, std_q2);
+
+		print_break("Push / Pop / Top");
+		ft::priority_queue<int, ft::vector<int>, std::less<int>, 3>	ft_q7;
+		std::priority_queue<int>				std_q7;
+		srand(42);
+		for (int i = 0; i < 1000; i++)
+		{
+			int	value = rand() % 500;
+			ft_q7.push(value);
+			std_q7.push(value);
+			if (i % 3 == 0)
+			{
+				assert(ft_q7.top() == std_q7.top());
+				ft_q7.pop();
+				std_q7.pop();
+			}
+		}
+		assert(ft_q7.size() == std_q7.size());
+		for (; std_q7.empty() == false; std_q7.pop(), ft_q7.pop())
+			assert(ft_q7.top() == std_q7.top());
+		std::cout << "OK\n" << std::endl;
+
+		print_break("Push_range");
+		std::vector<int>	few(3, 100);
+		ft_q2.push_range(few.begin(), few.end());
+		for (int i = 0; i < 3; i++)
+			std_q2.push(100);
+		priority_queue_check(ft_q2, std_q2);
+		ft_q1.push_range(values.begin(), values.end());
+		ft_q1.push_range(values.begin(), values.begin());
+		priority_queue_check(ft_q1, std::priority_queue<int>(values.begin(), values.end()));
+
+		print_break("Swap");
+		ft_q1.swap(ft_q3);
+		ft::swap(ft_q1, ft_q3);
+		std_q3.swap(std_q1);
+		std_q3.swap(std_q1);
+		priority_queue_check(ft_q3, std_q3);
+	}
+	{
+		clock_t start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		long	ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+
+		srand(42);
+		start_time = clock();
+		ft::priority_queue<int, ft::vector<int>, std::greater<int> >	ft_timers;
+		for (int i = 0; i < TIMERS; i++)
+			ft_timers.push(rand());
+		for (int i = 0; i < TIMERS; i++)
+		{
+			ft_sum += ft_timers.top();
+			ft_timers.pop();
+			ft_timers.push(rand());
+		}
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		srand(42);
+		start_time = clock();
+		std::priority_queue<int, std::vector<int>, std::greater<int> >	std_timers;
+		for (int i = 0; i < TIMERS; i++)
+			std_timers.push(rand());
+		for (int i = 0; i < TIMERS; i++)
+		{
+			std_sum += std_timers.top();
+			std_timers.pop();
+			std_timers.push(rand());
+		}
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		assert(ft_sum == std_sum);
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Slower by: " << ft_elapsed_time / std_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Priority_queue OK");
+	}
+	return (0);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   range_erase.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:37:52 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:39 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define ENTRIES		2000000
+#define WINDOWS		10
+#define WINDOW_SPAN	(RAND_MAX / 20)
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class Key, class T>
+void	map_check(ft::map<Key, T> const &ft_m, std::map<Key, T> const &std_m)
+{
+	tree_check(ft_m);
+	assert(ft_m.size() == std_m.size());
+	typename std::map<Key, T>::const_iterator	std_it = std_m.begin();
+	for (typename ft::map<Key, T>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it, ++std_it)
+		assert(it->first == std_it->first && it->second == std_it->second);
+	typename std::map<Key, T>::const_reverse_iterator	std_rit = std_m.rbegin();
+	for (typename ft::map<Key, T>::const_reverse_iterator it = ft_m.rbegin(); it != ft_m.rend(); ++it, ++std_rit)
+		assert(it->first == std_rit->first);
+}
+
+int	main(void)
+{
+	{
+		print_break("Map");
+		srand(42);
+		for (int round = 0; round < 300; round++)
+		{
+			ft::map<int, std::string>	ft_m;
+			std::map<int, std::string>	std_m;
+			int							n = rand() % 300;
+
+			for (int i = 0; i < n; i++)
+			{
+				int	key = rand() % 1000;
+				ft_m[key] = std::string(key % 5 + 1, 'a' + key % 26);
+				std_m[key] = std::string(key % 5 + 1, 'a' + key % 26);
+			}
+			if (round % 4 == 0)
+				ft_m.compact();
+			for (int cut = 0; cut < 3 && ft_m.empty() == false; cut++)
+			{
+				int	low = rand() % 1100 - 50;
+				int	high = low + rand() % (round % 2 ? 1100 : 100);
+				ft_m.erase(ft_m.lower_bound(low), ft_m.lower_bound(high));
+				std_m.erase(std_m.lower_bound(low), std_m.lower_bound(high));
+				map_check(ft_m, std_m);
+				ft_m[low] = "new";
+				std_m[low] = "new";
+				map_check(ft_m, std_m);
+			}
+			ft_m.erase(ft_m.begin(), ft_m.end());
+			assert(ft_m.empty());
+			tree_check(ft_m);
+			ft_m[1] = "one";
+			assert(ft_m.size() == 1 && ft_m.begin()->second == "one");
+		}
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		ft::set<int>	ft_s;
+		std::set<int>	std_s;
+		for (int i = 0; i < 5000; i++)
+		{
+			ft_s.insert(i);
+			std_s.insert(i);
+		}
+		ft::set<int>::iterator	first = ft_s.find(1000), last = ft_s.find(4999);
+		ft_s.erase(first, last);
+		std_s.erase(std_s.find(1000), std_s.find(4999));
+		tree_check(ft_s);
+		assert(ft_s.size() == std_s.size() && ft::equal(ft_s.begin(), ft_s.end(), std_s.begin()));
+		ft_s.erase(ft_s.begin(), ft_s.find(999));
+		std_s.erase(std_s.begin(), std_s.find(999));
+		ft_s.erase(ft_s.begin(), ft_s.begin());
+		tree_check(ft_s);
+		assert(ft_s.size() == 2 && ft::equal(ft_s.begin(), ft_s.end(), std_s.begin()));
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double					ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, int>		ft_m, ft_loop;
+		std::map<int, int>		std_m;
+		std::vector<int>		windows;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			int	key = rand();
+			ft_m[key] = i;
+			ft_loop[key] = i;
+			std_m[key] = i;
+		}
+		for (int i = 0; i < WINDOWS; i++)
+			windows.push_back(rand() % (RAND_MAX - WINDOW_SPAN));
+		std::cout << "Expiring " << WINDOWS << " key ranges of 5% from " << ft_m.size() << " entries" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < WINDOWS; i++)
+		{
+			ft::map<int, int>::iterator	first = ft_m.lower_bound(windows[i]), last = ft_m.lower_bound(windows[i] + WINDOW_SPAN);
+			ft_m.erase(first, last);
+		}
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (range erase) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < WINDOWS; i++)
+		{
+			ft::map<int, int>::iterator	first = ft_loop.lower_bound(windows[i]), last = ft_loop.lower_bound(windows[i] + WINDOW_SPAN);
+			while (first != last)
+				ft_loop.erase(first++);
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (erase loop) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_m == ft_loop);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		start_time = wall_time();
+		for (int i = 0; i < WINDOWS; i++)
+		{
+			std::map<int, int>::iterator	first = std_m.lower_bound(windows[i]), last = std_m.lower_bound(windows[i] + WINDOW_SPAN);
+			std_m.erase(first, last);
+		}
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(std_m.size() == ft_m.size());
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		start_time = wall_time();
+		ft_m.erase(ft_m.begin(), ft_m.end());
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (erase all) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		while (ft_loop.empty() == false)
+			ft_loop.erase(ft_loop.begin());
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (erase loop) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Range_erase OK");
+	}
+	return (0);
+}
@@ -0,0 +1,363 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   relocation.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:26:40 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:42 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/vector.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#define BUFFER_SIZE	4096
+#define BUFFERS		65536
+#define WORKING_SET	(128 * 1024)
+#define HANDLES		1000000
+
+struct	Buffer
+{
+	int		idx;
+	char	buff[BUFFER_SIZE];
+};
+
+/* Element whose size is not a multiple of 16 */
+struct	Triple
+{
+	char	a;
+	short	b;
+	int		c[4];
+};
+
+/* Owns a heap value and counts its copies and destructions, like a string or smart pointer */
+template <int Tag>
+struct	handle
+{
+	static long	copies;
+	static long	destroyed;
+
+	explicit handle(int value = 0) : data(new int(value)) {};
+	handle(const handle& other) : data(new int(*other.data)) { copies++; };
+	~handle() { delete data; destroyed++; };
+	handle&	operator=(const handle& other)
+	{
+		*data = *other.data;
+		return (*this);
+	};
+	bool	operator==(const handle& other) const { return (*data == *other.data); };
+
+	int	*data;
+};
+
+template <int Tag> long	handle<Tag>::copies = 0;
+template <int Tag> long	handle<Tag>::destroyed = 0;
+
+typedef handle<0>	relocatable_handle;
+typedef handle<1>	copied_handle;
+
+namespace ft
+{
+	template <> struct is_trivially_relocatable<relocatable_handle> : public bool_constant<true> {};
+}
+
+bool	is_multiple_of_three_int(int n)
+{
+	return (n % 3 == 0);
+}
+
+template <class Handle>
+bool	is_multiple_of_three(const Handle& h)
+{
+	return (*h.data % 3 == 0);
+}
+
+/* Removes the multiples of three and throws on the value given to it */
+template <class Handle>
+struct	throwing_multiple_of_three
+{
+	explicit throwing_multiple_of_three(int trap) : trap(trap) {};
+	bool	operator()(const Handle& h) const
+	{
+		if (*h.data == this->trap)
+			throw std::runtime_error("trap");
+		return (*h.data % 3 == 0);
+	};
+
+	int	trap;
+};
+
+/* Runs the erase paths on a vector of Handle and checks them against std::vector */
+template <class Handle>
+void	erase_check(void)
+{
+	ft::vector<Handle>	ft_v;
+	std::vector<int>	std_v;
+	std::size_t			indices[] = { 0, 4, 5, 9, 9, 30 };
+
+	for (int i = 0; i < 40; i++)
+	{
+		ft_v.push_back(Handle(i));
+		std_v.push_back(i);
+	}
+	ft_v.erase(ft_v.begin() + 3);
+	std_v.erase(std_v.begin() + 3);
+	ft_v.erase(ft_v.begin() + 10, ft_v.begin() + 15);
+	std_v.erase(std_v.begin() + 10, std_v.begin() + 15);
+	ft_v.erase_indices(indices, indices + 6);
+	for (int i = 5; i >= 0; i--)
+		if (i == 0 || indices[i] != indices[i - 1])
+			std_v.erase(std_v.begin() + indices[i]);
+	ft_v.unordered_erase(ft_v.begin() + 2);
+	std_v[2] = std_v.back();
+	std_v.pop_back();
+	ft_v.unordered_erase(ft_v.end() - 1);
+	std_v.pop_back();
+	assert(ft::erase_if(ft_v, is_multiple_of_three<Handle>) == (std::size_t)std::count_if(std_v.begin(), std_v.end(), is_multiple_of_three_int));
+	std_v.erase(std::remove_if(std_v.begin(), std_v.end(), is_multiple_of_three_int), std_v.end());
+	assert(ft_v.size() == std_v.size());
+	for (std::size_t i = 0; i < std_v.size(); i++)
+		assert(*ft_v[i].data == std_v[i]);
+
+	/* A throwing predicate leaves the bitwise path with the elements it did not reach, each one exactly once */
+	if (ft::is_trivially_relocatable<Handle>::value == false)
+		return ;
+	ft_v.clear();
+	std_v.clear();
+	for (int i = 0; i < 60; i++)
+	{
+		ft_v.push_back(Handle(i));
+		std_v.push_back(i);
+	}
+	try
+	{
+		ft::erase_if(ft_v, throwing_multiple_of_three<Handle>(40));
+		assert(false);
+	}
+	catch (std::runtime_error &e)
+	{
+		std::vector<int>::iterator	trap = std::find(std_v.begin(), std_v.end(), 40);
+		std_v.erase(std::remove_if(std_v.begin(), trap, is_multiple_of_three_int), trap);
+	}
+	assert(ft_v.size() == std_v.size());
+	for (std::size_t i = 0; i < std_v.size(); i++)
+		assert(*ft_v[i].data == std_v[i]);
+}
+
+/* Cache-resident data scanned by a thread while the vector writes run */
+struct	shared_workload
+{
+	shared_workload() : data(WORKING_SET, 1), stop(false), scans(0) {};
+
+	std::vector<int>	data;
+	volatile bool		stop;
+	long				scans;
+};
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Times the reallocation of a full vector of BUFFERS buffers into one twice as large */
+double	time_reserve(void)
+{
+	ft::vector<Buffer>	v(BUFFERS);
+	double				start_time;
+	double				elapsed_time;
+
+	for (int i = 0; i < BUFFERS; i++)
+	{
+		v[i].idx = i;
+		v[i].buff[BUFFER_SIZE - 1] = static_cast<char>(i);
+	}
+	start_time = wall_time();
+	v.reserve(BUFFERS * 2);
+	elapsed_time = wall_time() - start_time;
+	for (int i = 0; i < BUFFERS; i++)
+		assert(v[i].idx == i && v[i].buff[BUFFER_SIZE - 1] == static_cast<char>(i));
+	return (elapsed_time);
+}
+
+void	*scan_working_set(void *arg)
+{
+	shared_workload	*shared = static_cast<shared_workload *>(arg);
+	long			sum = 0;
+
+	while (shared->stop == false)
+	{
+		for (std::size_t i = 0; i < shared->data.size(); i++)
+			sum += shared->data[i];
+		shared->scans++;
+	}
+	return (sum == 0 ? arg : NULL);
+}
+
+/* Fills and relocates big Buffer vectors while another thread scans its working set. Returns the scans per second */
+double	scans_during_writes(double& write_time)
+{
+	shared_workload	shared;
+	pthread_t		worker;
+	Buffer			proto;
+	double			start_time;
+
+	proto.idx = 42;
+	std::memset(proto.buff, 'b', BUFFER_SIZE);
+	pthread_create(&worker, NULL, scan_working_set, &shared);
+	start_time = wall_time();
+	for (int round = 0; round < 4; round++)
+	{
+		ft::vector<Buffer>	v(BUFFERS / 4, proto);
+		v.reserve(BUFFERS / 2);
+		assert(v.back().idx == 42 && v.back().buff[BUFFER_SIZE - 1] == 'b');
+	}
+	write_time = wall_time() - start_time;
+	shared.stop = true;
+	pthread_join(worker, NULL);
+	return (shared.scans / write_time);
+}
+
+int	main(void)
+{
+	ft::relocation_policy&	settings = ft::relocation_settings();
+	ft::relocation_policy	defaults = settings;
+
+	{
+		print_break("Parallel reserve / insert");
+		ft::vector<int>		ft_v;
+		std::vector<int>	std_v;
+		std::vector<int>	std_copy;
+
+		settings.parallel_threshold = 4096;
+		settings.threads = 4;
+		for (int i = 0; i < 100000; i++)
+		{
+			ft_v.push_back(i);
+			std_v.push_back(i);
+		}
+		ft_v.reserve(300000);
+		ft_v.insert(ft_v.begin() + 500, 200000, -1);
+		std_v.insert(std_v.begin() + 500, 200000, -1);
+		std_copy = std_v;
+		ft_v.insert(ft_v.begin() + 7, std_copy.begin(), std_copy.end());
+		std_v.insert(std_v.begin() + 7, std_copy.begin(), std_copy.end());
+		assert(ft_v.size() == std_v.size());
+		assert(ft::equal(ft_v.begin(), ft_v.end(), std_v.begin()));
+		settings = defaults;
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Streaming fill / reserve");
+		ft::vector<char>	ft_v1(37, 'x');
+		ft::vector<Triple>	ft_v2;
+		Triple				t = { 'a', 2, { 3, 4, 5, 6 } };
+
+		settings.streaming_threshold = 0;
+		ft::vector<char>	ft_v3(1000, 'y');
+		ft_v2.assign(101, t);
+		ft_v1.reserve(100);
+		ft_v1.insert(ft_v1.begin() + 3, 5, 'z');
+		ft_v2.insert(ft_v2.begin() + 50, 77, t);
+		assert(ft_v1.size() == 42 && ft_v1[2] == 'x' && ft_v1[3] == 'z' && ft_v1[7] == 'z' && ft_v1[8] == 'x' && ft_v1[41] == 'x');
+		assert(std::count(ft_v3.begin(), ft_v3.end(), 'y') == 1000);
+		assert(ft_v2.size() == 178);
+		for (std::size_t i = 0; i < ft_v2.size(); i++)
+			assert(ft_v2[i].a == 'a' && ft_v2[i].b == 2 && ft_v2[i].c[0] == 3 && ft_v2[i].c[3] == 6);
+		settings = defaults;
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Trivially relocatable");
+		{
+			ft::vector<relocatable_handle>	ft_v;
+			ft::vector<copied_handle>		ft_v2;
+
+			for (int i = 0; i < 1000; i++)
+			{
+				ft_v.push_back(relocatable_handle(i));
+				ft_v2.push_back(copied_handle(i));
+			}
+			ft_v.insert(ft_v.begin() + 10, 3000, relocatable_handle(-1));
+			std::cout << "relocatable copies: " << relocatable_handle::copies << ", copied copies: " << copied_handle::copies << std::endl;
+			assert(relocatable_handle::copies == 1000 + 3000);
+			assert(copied_handle::copies > 1000);
+			assert(relocatable_handle::destroyed == 1000 + 1);
+			assert(*ft_v[9].data == 9 && *ft_v[10].data == -1 && *ft_v[3009].data == -1 && *ft_v[3010].data == 10);
+		}
+		assert(relocatable_handle::destroyed == relocatable_handle::copies + 1000 + 1);
+		erase_check<relocatable_handle>();
+		erase_check<copied_handle>();
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Performance");
+		std::size_t	thresholds[] = { std::size_t(1) << 20, std::size_t(16) << 20, std::size_t(64) << 20, std::size_t(1) << 40 };
+		std::size_t	threads = defaults.threads > 1 ? defaults.threads : 4;
+		double		serial_elapsed_time;
+		double		elapsed_time;
+
+		std::cout << "Relocating " << (std::size_t(BUFFERS) * sizeof(Buffer) >> 20) << " MB with " << threads << " threads" << std::endl;
+		settings.threads = 1;
+		time_reserve();
+		serial_elapsed_time = time_reserve();
+		std::cout << "serial elapsed time: " << std::fixed << std::setprecision(6) << serial_elapsed_time << " seconds" << std::endl;
+		settings.threads = threads;
+		for (std::size_t i = 0; i < sizeof(thresholds) / sizeof(*thresholds); i++)
+		{
+			settings.parallel_threshold = thresholds[i];
+			elapsed_time = time_reserve();
+			std::cout << "threshold " << std::setw(7) << (thresholds[i] >> 20) << " MB elapsed time: " << std::fixed << std::setprecision(6) << elapsed_time << " seconds (" << serial_elapsed_time / elapsed_time << "x)" << std::endl;
+		}
+		settings = defaults;
+		std::cout << std::endl;
+
+		double	cached_scans, streaming_scans, cached_write_time, streaming_write_time;
+
+		std::cout << "Scanning a " << (WORKING_SET * sizeof(int) >> 10) << " KB working set while filling and relocating Buffer vectors" << std::endl;
+		cached_scans = scans_during_writes(cached_write_time);
+		std::cout << "cached stores:    " << std::fixed << std::setprecision(6) << cached_write_time << " seconds, " << std::setprecision(1) << cached_scans << " scans per second" << std::endl;
+		settings.streaming_threshold = std::size_t(1) << 20;
+		streaming_scans = scans_during_writes(streaming_write_time);
+		std::cout << "streaming stores: " << std::fixed << std::setprecision(6) << streaming_write_time << " seconds, " << std::setprecision(1) << streaming_scans << " scans per second" << std::endl;
+		std::cout << "Working set throughput: " << std::setprecision(6) << streaming_scans / cached_scans << "x, write time: " << cached_write_time / streaming_write_time << "x\n" << std::endl;
+		settings = defaults;
+
+		double	ft_elapsed_time, std_elapsed_time, start_time;
+		{
+			ft::vector<relocatable_handle>	ft_v;
+			start_time = wall_time();
+			for (int i = 0; i < HANDLES; i++)
+				ft_v.push_back(relocatable_handle(i));
+			ft_elapsed_time = wall_time() - start_time;
+		}
+		{
+			std::vector<copied_handle>	std_v;
+			start_time = wall_time();
+			for (int i = 0; i < HANDLES; i++)
+				std_v.push_back(copied_handle(i));
+			std_elapsed_time = wall_time() - start_time;
+		}
+		std::cout << "Pushing " << HANDLES << " handles" << std::endl;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Relocation OK");
+	}
+	return (0);
+}
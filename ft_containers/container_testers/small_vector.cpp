@@ -0,0 +1,205 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:03:52 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 12:03:52 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/small_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#define MESSAGES	1000000
+
+template <class T, std::size_t N>
+void	ft_small_vector_print(ft::small_vector<T, N> const &vec)
+{
+	std::cout << "Size: " << vec.size() << " (" << (vec.is_inline() ? "inline" : "heap") << ")" << std::endl;
+	std::cout << "Content: " << std::endl;
+	for (typename ft::small_vector<T, N>::const_iterator it = vec.begin(); it != vec.end(); it++)
+		std::cout << *it << " ";
+	std::cout << "\n" << std::endl;
+}
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+template <class T, std::size_t N>
+void	small_vector_check(ft::small_vector<T, N> const &ft_vec, std::vector<T> const &std_vec)
+{
+	ft_small_vector_print(ft_vec);
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	assert(ft_vec.capacity() >= ft_vec.size());
+	assert(ft_vec.is_inline() == (ft_vec.capacity() == N));
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+		assert(ft_vec[i] == std_vec[i]);
+	typename ft::small_vector<T, N>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	typename std::vector<T>::const_reverse_iterator			std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+}
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		ft::small_vector<int, 4>			ft_v1;
+		ft::small_vector<int, 4>			ft_v2(3, 42);
+		ft::small_vector<int, 4>			ft_v3(6, 7);
+		ft::small_vector<int, 4>			ft_v4(ft_v3.begin(), ft_v3.end());
+		ft::small_vector<int, 4>			ft_v5(ft_v2);
+
+		std::vector<int>					std_v1;
+		std::vector<int>					std_v2(3, 42);
+		std::vector<int>					std_v3(6, 7);
+
+		small_vector_check(ft_v1, std_v1);
+		small_vector_check(ft_v2, std_v2);
+		small_vector_check(ft_v3, std_v3);
+		small_vector_check(ft_v4, std_v3);
+		small_vector_check(ft_v5, std_v2);
+		assert(ft_v2.is_inline() && ft_v3.is_inline() == false);
+
+		print_break("Push_back / Pop_back (inline to heap)");
+		ft::small_vector<std::string, 2>	ft_s;
+		std::vector<std::string>			std_s;
+		for (int i = 0; i < 10; i++)
+		{
+			ft_s.push_back(std::string(i + 1, 'a' + i));
+			std_s.push_back(std::string(i + 1, 'a' + i));
+			if (i == 1)
+				assert(ft_s.is_inline());
+		}
+		small_vector_check(ft_s, std_s);
+		ft_s.push_back(ft_s[0]);
+		std_s.push_back(std_s[0]);
+		for (int i = 0; i < 9; i++)
+		{
+			ft_s.pop_back();
+			std_s.pop_back();
+		}
+		small_vector_check(ft_s, std_s);
+
+		print_break("Shrink_to_fit (heap to inline)");
+		ft_s.shrink_to_fit();
+		assert(ft_s.is_inline());
+		small_vector_check(ft_s, std_s);
+
+		print_break("Element access");
+		assert(ft_v3.at(5) == 7);
+		assert(ft_v2.front() == 42 && ft_v2.back() == 42);
+		assert(ft_v2.data() == &ft_v2[0]);
+		try
+		{
+			ft_v2.at(3);
+			assert(false);
+		}
+		catch (std::out_of_range &e)
+		{
+			std::cout << "Out of range caught\n" << std::endl;
+		}
+
+		print_break("Insert / Erase");
+		ft::small_vector<int, 8>	ft_v6;
+		std::vector<int>			std_v6;
+		for (int i = 0; i < 5; i++)
+		{
+			ft_v6.push_back(i);
+			std_v6.push_back(i);
+		}
+		ft_v6.insert(ft_v6.begin() + 2, 99);
+		std_v6.insert(std_v6.begin() + 2, 99);
+		ft_v6.insert(ft_v6.begin() + 1, 2, -1);
+		std_v6.insert(std_v6.begin() + 1, 2, -1);
+		small_vector_check(ft_v6, std_v6);
+		ft_v6.insert(ft_v6.end() - 1, std_v3.begin(), std_v3.end());
+		std_v6.insert(std_v6.end() - 1, std_v3.begin(), std_v3.end());
+		small_vector_check(ft_v6, std_v6);
+		ft_v6.erase(ft_v6.begin() + 3, ft_v6.begin() + 9);
+		std_v6.erase(std_v6.begin() + 3, std_v6.begin() + 9);
+		ft_v6.erase(ft_v6.begin());
+		std_v6.erase(std_v6.begin());
+		small_vector_check(ft_v6, std_v6);
+
+		print_break("Resize / Reserve / Assign");
+		ft_v6.resize(20, 5);
+		std_v6.resize(20, 5);
+		small_vector_check(ft_v6, std_v6);
+		ft_v6.resize(3);
+		std_v6.resize(3);
+		small_vector_check(ft_v6, std_v6);
+		ft_v1.reserve(3);
+		assert(ft_v1.is_inline() && ft_v1.capacity() == 4);
+		ft_v1.reserve(100);
+		assert(ft_v1.is_inline() == false && ft_v1.capacity() == 100);
+		ft_v1.assign(2, 8);
+		std_v1.assign(2, 8);
+		small_vector_check(ft_v1, std_v1);
+		ft_v1.assign(std_v3.begin(), std_v3.end());
+		small_vector_check(ft_v1, std_v3);
+
+		print_break("Swap / Operators");
+		ft_v2.swap(ft_v3);
+		small_vector_check(ft_v2, std_v3);
+		small_vector_check(ft_v3, std_v2);
+		ft::swap(ft_v1, ft_v4);
+		small_vector_check(ft_v1, std_v3);
+		ft_v5 = ft_v2;
+		assert(ft_v5 == ft_v2 && ft_v5 >= ft_v2 && ft_v5 <= ft_v2);
+		ft_v5.push_back(8);
+		assert(ft_v5 != ft_v2 && ft_v2 < ft_v5 && ft_v5 > ft_v2);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		clock_t start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		long	ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+
+		start_time = clock();
+		for (int i = 0; i < MESSAGES; i++)
+		{
+			ft::small_vector<int, 8>	fields;
+			for (int j = 0; j < 6; j++)
+				fields.push_back(i + j);
+			ft_sum += fields.back();
+		}
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = clock();
+		for (int i = 0; i < MESSAGES; i++)
+		{
+			std::vector<int>	fields;
+			for (int j = 0; j < 6; j++)
+				fields.push_back(i + j);
+			std_sum += fields.back();
+		}
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		assert(ft_sum == std_sum);
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Slower by: " << ft_elapsed_time / std_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Small_vector OK");
+	}
+	return (0);
+}
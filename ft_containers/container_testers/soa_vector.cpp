@@ -0,0 +1,224 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soa_vector.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:14 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 11:07:52 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/soa_vector.hpp"
+#include "../srcs/vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define ROWS	1000000
+#define SCANS	50
+
+typedef ft::pair<int, std::string>					row;
+typedef ft::pair<int, ft::pair<double, char> >		triple;
+
+template <class T>
+void	ft_soa_vector_print(ft::soa_vector<T> const &vec)
+{
+	std::cout << "Size: " << vec.size() << std::endl;
+	std::cout << "Content: " << std::endl;
+	for (typename ft::soa_vector<T>::const_iterator it = vec.begin(); it != vec.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << "\n" << std::endl;
+}
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+void	soa_vector_check(ft::soa_vector<row> const &ft_vec, std::vector<row> const &std_vec)
+{
+	ft_soa_vector_print(ft_vec);
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	assert(ft_vec.capacity() >= ft_vec.size());
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		assert(ft_vec[i] == std_vec[i]);
+		assert(ft_vec.column<0>()[i] == std_vec[i].first);
+		assert(ft_vec.column<1>()[i] == std_vec[i].second);
+	}
+	ft::soa_vector<row>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	std::vector<row>::const_reverse_iterator		std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+}
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		std::vector<row>		std_v1;
+		std::vector<row>		std_v2(3, ft::make_pair(1, std::string("one")));
+		std::vector<row>		std_v3;
+		for (int i = 0; i < 6; i++)
+			std_v3.push_back(ft::make_pair(i, std::string(i + 1, 'a' + i)));
+
+		ft::soa_vector<row>		ft_v1;
+		ft::soa_vector<row>		ft_v2(3, ft::make_pair(1, std::string("one")));
+		ft::soa_vector<row>		ft_v3(std_v3.begin(), std_v3.end());
+		ft::soa_vector<row>		ft_v4(ft_v3);
+		ft::soa_vector<row>		ft_v5(ft_v3.rbegin(), ft_v3.rend());
+
+		soa_vector_check(ft_v1, std_v1);
+		soa_vector_check(ft_v2, std_v2);
+		soa_vector_check(ft_v3, std_v3);
+		soa_vector_check(ft_v4, std_v3);
+		soa_vector_check(ft_v5, std::vector<row>(std_v3.rbegin(), std_v3.rend()));
+
+		print_break("Proxy references");
+		ft_v4[0].first = 100;
+		ft_v4.back().second = "last";
+		ft_v4.begin()->second = "arrow";
+		*(ft_v4.begin() + 1) = ft::make_pair(-1, std::string("assigned"));
+		ft_v4[2] = ft_v4[3];
+		row	copy = ft_v4.front();
+		std_v3[0] = ft::make_pair(100, std::string("arrow"));
+		std_v3[1] = ft::make_pair(-1, std::string("assigned"));
+		std_v3[2] = std_v3[3];
+		std_v3[5].second = "last";
+		assert(copy == std_v3[0]);
+		soa_vector_check(ft_v4, std_v3);
+		assert(ft_v4.rbegin()->second == "last" && (ft_v4.rbegin() + 5)->first == 100);
+		ft_v4.rbegin()->first = 55;
+		std_v3.back().first = 55;
+		soa_vector_check(ft_v4, std_v3);
+
+		print_break("Sorting through the proxies");
+		ft::soa_vector<row>	ft_sorted(ft_v4);
+		std::vector<row>	std_sorted(std_v3);
+		std::sort(ft_sorted.begin(), ft_sorted.end());
+		std::sort(std_sorted.begin(), std_sorted.end());
+		soa_vector_check(ft_sorted, std_sorted);
+		swap(ft_sorted[0], ft_sorted[1]);
+		std::swap(std_sorted[0], std_sorted[1]);
+		std::reverse(ft_sorted.begin(), ft_sorted.end());
+		std::reverse(std_sorted.begin(), std_sorted.end());
+		soa_vector_check(ft_sorted, std_sorted);
+
+		print_break("Push_back / Insert / Erase");
+		for (int i = 0; i < 20; i++)
+		{
+			ft_v1.push_back(ft::make_pair(i, std::string(1, 'A' + i)));
+			std_v1.push_back(ft::make_pair(i, std::string(1, 'A' + i)));
+		}
+		ft_v1.push_back(ft_v1[0]);
+		std_v1.push_back(std_v1[0]);
+		ft_v1.pop_back();
+		std_v1.pop_back();
+		ft_v1.insert(ft_v1.begin() + 3, ft::make_pair(42, std::string("x")));
+		std_v1.insert(std_v1.begin() + 3, ft::make_pair(42, std::string("x")));
+		ft_v1.insert(ft_v1.begin(), 2, ft::make_pair(7, std::string("y")));
+		std_v1.insert(std_v1.begin(), 2, ft::make_pair(7, std::string("y")));
+		ft_v1.insert(ft_v1.end() - 2, std_v2.begin(), std_v2.end());
+		std_v1.insert(std_v1.end() - 2, std_v2.begin(), std_v2.end());
+		soa_vector_check(ft_v1, std_v1);
+		ft_v1.erase(ft_v1.begin() + 5, ft_v1.begin() + 12);
+		std_v1.erase(std_v1.begin() + 5, std_v1.begin() + 12);
+		ft_v1.erase(ft_v1.begin());
+		std_v1.erase(std_v1.begin());
+		soa_vector_check(ft_v1, std_v1);
+
+		print_break("Resize / Assign / Swap / Operators");
+		ft_v1.resize(4);
+		std_v1.resize(4);
+		soa_vector_check(ft_v1, std_v1);
+		ft_v1.resize(6, ft::make_pair(9, std::string("z")));
+		std_v1.resize(6, ft::make_pair(9, std::string("z")));
+		soa_vector_check(ft_v1, std_v1);
+		ft_v2.assign(std_v1.begin(), std_v1.end());
+		assert(ft_v2 == ft_v1);
+		ft_v2.swap(ft_v3);
+		ft::swap(ft_v2, ft_v4);
+		soa_vector_check(ft_v2, std_v3);
+		assert(ft_v3 == ft_v1 && ft_v3 <= ft_v1 && ft_v3 >= ft_v1);
+		ft_v3.back().first = 10;
+		assert(ft_v3 != ft_v1 && ft_v1 < ft_v3 && ft_v3 > ft_v1);
+		ft_v5 = ft_v1;
+		soa_vector_check(ft_v5, std_v1);
+		try
+		{
+			ft_v5.at(6);
+			assert(false);
+		}
+		catch (std::out_of_range &e)
+		{
+			std::cout << "Out of range caught\n" << std::endl;
+		}
+
+		print_break("Nested pairs");
+		ft::soa_vector<triple>	ft_t;
+		for (int i = 0; i < 10; i++)
+			ft_t.push_back(ft::make_pair(i, ft::make_pair(i * 0.5, char('a' + i))));
+		ft_t[4].second.second = 'Z';
+		for (int i = 0; i < 10; i++)
+		{
+			assert(ft_t.column<0>()[i] == i);
+			assert(ft_t.column<1>()[i] == i * 0.5);
+			assert(ft_t.column<2>()[i] == (i == 4 ? 'Z' : 'a' + i));
+		}
+		triple	t = ft_t.back();
+		assert(t == ft::make_pair(9, ft::make_pair(4.5, 'j')));
+		std::sort(ft_t.rbegin(), ft_t.rend());
+		assert(ft_t.front() == t && ft_t.rbegin()->second.first == 0.0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		clock_t start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		long	ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+
+		ft::soa_vector<ft::pair<int, double> >	ft_rows;
+		ft::vector<ft::pair<int, double> >		std_rows;
+		for (int i = 0; i < ROWS; i++)
+		{
+			ft_rows.push_back(ft::make_pair(i, i * 2.0));
+			std_rows.push_back(ft::make_pair(i, i * 2.0));
+		}
+
+		start_time = clock();
+		for (int scan = 0; scan < SCANS; scan++)
+		{
+			const int	*keys = ft_rows.column<0>();
+			for (int i = 0; i < ROWS; i++)
+				ft_sum += keys[i];
+		}
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "soa key scan elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = clock();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (int i = 0; i < ROWS; i++)
+				std_sum += std_rows[i].first;
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		assert(ft_sum == std_sum);
+		std::cout << "aos key scan elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Slower by: " << ft_elapsed_time / std_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Soa_vector OK");
+	}
+	return (0);
+}
@@ -0,0 +1,207 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spsc_ring.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:17 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:45 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/spsc_ring.hpp"
+#include "tester_utils.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <queue>
+#include <pthread.h>
+#include <sched.h>
+
+#define ITEMS	2000000
+#define BATCH	64
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+typedef ft::spsc_ring<long, 1024>	ring_type;
+
+/* Mutex-protected std::queue used as the baseline */
+struct	locked_queue
+{
+	std::queue<long>	queue;
+	pthread_mutex_t		lock;
+};
+
+void	*ring_producer(void *arg)
+{
+	ring_type	*ring = static_cast<ring_type *>(arg);
+
+	for (long i = 0; i < ITEMS; i++)
+		while (ring->try_push(i) == false)
+			sched_yield();
+	return (NULL);
+}
+
+void	*ring_batch_producer(void *arg)
+{
+	ring_type			*ring = static_cast<ring_type *>(arg);
+	std::vector<long>	batch(BATCH);
+
+	for (long i = 0; i < ITEMS; i += BATCH)
+	{
+		for (long j = 0; j < BATCH; j++)
+			batch[j] = i + j;
+		std::vector<long>::iterator	it = batch.begin();
+		while ((it = ring->push_range(it, batch.end())) != batch.end())
+			sched_yield();
+	}
+	return (NULL);
+}
+
+void	*locked_producer(void *arg)
+{
+	locked_queue	*shared = static_cast<locked_queue *>(arg);
+
+	for (long i = 0; i < ITEMS; i++)
+	{
+		pthread_mutex_lock(&shared->lock);
+		shared->queue.push(i);
+		pthread_mutex_unlock(&shared->lock);
+	}
+	return (NULL);
+}
+
+double	run_ring(void *(*producer)(void *), bool batch)
+{
+	ring_type			ring;
+	pthread_t			thread;
+	std::vector<long>	out(BATCH);
+	long				expected = 0;
+	long				value;
+	double				start_time = wall_time();
+
+	pthread_create(&thread, NULL, producer, &ring);
+	while (expected < ITEMS)
+	{
+		if (batch)
+		{
+			ring_type::size_type	count = ring.pop_range(out.begin(), BATCH);
+			for (ring_type::size_type i = 0; i < count; i++)
+				assert(out[i] == expected++);
+			if (count == 0)
+				sched_yield();
+		}
+		else if (ring.try_pop(value))
+			assert(value == expected++);
+		else
+			sched_yield();
+	}
+	pthread_join(thread, NULL);
+	assert(ring.empty());
+	return (wall_time() - start_time);
+}
+
+double	run_locked(void)
+{
+	locked_queue	shared;
+	pthread_t		thread;
+	long			expected = 0;
+	double			start_time = wall_time();
+
+	pthread_mutex_init(&shared.lock, NULL);
+	pthread_create(&thread, NULL, locked_producer, &shared);
+	while (expected < ITEMS)
+	{
+		pthread_mutex_lock(&shared.lock);
+		if (shared.queue.empty() == false)
+		{
+			assert(shared.queue.front() == expected++);
+			shared.queue.pop();
+			pthread_mutex_unlock(&shared.lock);
+		}
+		else
+		{
+			pthread_mutex_unlock(&shared.lock);
+			sched_yield();
+		}
+	}
+	pthread_join(thread, NULL);
+	pthread_mutex_destroy(&shared.lock);
+	return (wall_time() - start_time);
+}
+
+int	main(void)
+{
+	{
+		print_break("Try_push / Try_pop");
+		ft::spsc_ring<std::string, 4>	r;
+		std::string						value;
+
+		assert(r.empty());
+		assert(r.capacity() == 4);
+		assert(r.try_pop(value) == false);
+		for (int i = 0; i < 4; i++)
+			assert(r.try_push(std::string(1, 'a' + i)));
+		assert(r.try_push("e") == false);
+		assert(r.size() == 4);
+		for (int round = 0; round < 10; round++)
+		{
+			assert(r.try_pop(value));
+			assert(r.try_push(value));
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			assert(r.try_pop(value));
+			assert(value == std::string(1, 'a' + (i + 10) % 4));
+		}
+		assert(r.empty());
+		r.try_push("left over");
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Push_range / Pop_range");
+		ft::spsc_ring<int, 8>	r;
+		std::vector<int>		in;
+		std::vector<int>		out;
+
+		for (int i = 0; i < 12; i++)
+			in.push_back(i);
+		std::vector<int>::iterator	it = r.push_range(in.begin(), in.end());
+		assert(it == in.begin() + 8);
+		assert(r.size() == 8);
+		assert(r.pop_range(std::back_inserter(out), 5) == 5);
+		it = r.push_range(it, in.end());
+		assert(it == in.end());
+		assert(r.pop_range(std::back_inserter(out), 100) == 7);
+		assert(out == in);
+		assert(r.pop_range(std::back_inserter(out), 100) == 0);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double	single_elapsed_time, batch_elapsed_time, locked_elapsed_time;
+		print_break("Performance");
+
+		single_elapsed_time = run_ring(ring_producer, false);
+		std::cout << "ft::spsc_ring elapsed time: " << std::fixed << std::setprecision(6) << single_elapsed_time << " seconds" << std::endl;
+		batch_elapsed_time = run_ring(ring_batch_producer, true);
+		std::cout << "ft::spsc_ring (batch) elapsed time: " << std::fixed << std::setprecision(6) << batch_elapsed_time << " seconds" << std::endl;
+		locked_elapsed_time = run_locked();
+		std::cout << "mutex + std::queue elapsed time: " << std::fixed << std::setprecision(6) << locked_elapsed_time << " seconds" << std::endl;
+		std::cout << "Faster by: " << locked_elapsed_time / single_elapsed_time << "x times (" << locked_elapsed_time / batch_elapsed_time << "x with batches)\n" << std::endl;
+		print_break("All test finished: Spsc_ring OK");
+	}
+	return (0);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tester_utils.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:30:08 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:30:08 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TESTER_UTILS_HPP
+# define TESTER_UTILS_HPP
+
+# include <cassert>
+# include <cstddef>
+# include <sys/time.h>
+# include "../srcs/rbtree_algorithm.hpp"
+
+/* Returns the wall-clock time in seconds, for the performance sections */
+inline double	wall_time(void)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+/* Checks the red-black rules below node and returns its black height */
+template <class Node, class Leaf>
+int	black_height(Node node, Leaf parent)
+{
+	if (node == NULL)
+		return (1);
+	assert(node->_parent == parent);
+	if (node->_black == false)
+		assert(ft::node_is_black(node->_left) && ft::node_is_black(node->_right));
+	int	left = black_height(node->_left, static_cast<Leaf>(node));
+	assert(left == black_height(node->_right, static_cast<Leaf>(node)));
+	return (left + node->_black);
+}
+
+/* Checks the shape of the tree under a container */
+template <class Container>
+void	tree_check(Container const &ft_c)
+{
+	typedef typename Container::const_iterator::node_pointer		node_pointer;
+	typedef typename Container::const_iterator::leaf_node_pointer	leaf_node_pointer;
+
+	if (ft_c.empty())
+	{
+		assert(ft_c.begin() == ft_c.end() && ft_c.end().base()->_left == NULL);
+		return ;
+	}
+	node_pointer	root = ft_c.begin().node_ptr();
+	while (root->_parent != ft_c.end().base())
+		root = root->get_parent_ptr();
+	assert(root->_black);
+	black_height(root, static_cast<leaf_node_pointer>(ft_c.end().base()));
+}
+
+#endif
@@ -0,0 +1,202 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   threaded_rbtree.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:58:41 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:31:48 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/map.hpp"
+#include "../srcs/set.hpp"
+#include "tester_utils.hpp"
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifndef FT_THREADED_RBTREE
+# error "Build with -D FT_THREADED_RBTREE"
+#endif
+
+#define ENTRIES		2000000
+#define SCANS		10
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+/* Compares an element of the ft container to one of the std container */
+template <class T>
+bool	same_value(T const &ft_value, T const &std_value)
+{
+	return (ft_value == std_value);
+}
+
+template <class Key, class T>
+bool	same_value(ft::pair<const Key, T> const &ft_value, std::pair<const Key, T> const &std_value)
+{
+	return (ft_value.first == std_value.first && ft_value.second == std_value.second);
+}
+
+/* Checks both directions of the threads against std, and the forward threads against the parent links */
+template <class FtContainer, class StdContainer>
+void	threaded_check(FtContainer const &ft_c, StdContainer const &std_c)
+{
+	typedef typename FtContainer::const_iterator		ft_iterator;
+	typedef typename ft_iterator::leaf_node_pointer		leaf_node_pointer;
+
+	assert(ft_c.size() == std_c.size());
+	typename StdContainer::const_iterator	std_it = std_c.begin();
+	for (ft_iterator it = ft_c.begin(); it != ft_c.end(); ++it, ++std_it)
+	{
+		assert(same_value(*it, *std_it));
+		assert(ft::iter_to_next<leaf_node_pointer>(it.node_ptr()) == (++ft_iterator(it)).base());
+	}
+	assert(std_it == std_c.end());
+	typename StdContainer::const_reverse_iterator	std_rit = std_c.rbegin();
+	for (typename FtContainer::const_reverse_iterator it = ft_c.rbegin(); it != ft_c.rend(); ++it, ++std_rit)
+		assert(same_value(*it, *std_rit));
+	assert(std_rit == std_c.rend());
+}
+
+int	main(void)
+{
+	{
+		print_break("Map");
+		ft::map<int, std::string>	ft_m;
+		std::map<int, std::string>	std_m;
+		srand(42);
+		for (int round = 0; round < 40; round++)
+		{
+			for (int i = 0; i < 200; i++)
+			{
+				int	key = rand() % 1000;
+				if (rand() % 2)
+					ft_m.insert(ft::make_pair(key, std::string(key % 7 + 1, 'x')));
+				else
+					ft_m.insert(ft_m.lower_bound(key), ft::make_pair(key, std::string(key % 7 + 1, 'x')));
+				std_m.insert(std::make_pair(key, std::string(key % 7 + 1, 'x')));
+			}
+			for (int i = 0; i < 150; i++)
+			{
+				int	key = rand() % 1000;
+				ft_m.erase(key);
+				std_m.erase(key);
+			}
+			if (ft_m.size() > 10)
+			{
+				ft::map<int, std::string>::iterator		ft_first = ft_m.begin(), ft_last = ft_m.begin();
+				std::map<int, std::string>::iterator	std_first = std_m.begin(), std_last = std_m.begin();
+				std::advance(ft_first, 2);
+				std::advance(ft_last, 7);
+				std::advance(std_first, 2);
+				std::advance(std_last, 7);
+				ft_m.erase(ft_first, ft_last);
+				std_m.erase(std_first, std_last);
+			}
+			threaded_check(ft_m, std_m);
+		}
+
+		ft::map<int, std::string>	ft_copy(ft_m);
+		threaded_check(ft_copy, std_m);
+		ft::map<int, std::string>	ft_other;
+		ft_other[5] = "five";
+		ft_copy.swap(ft_other);
+		threaded_check(ft_other, std_m);
+		assert(ft_copy.size() == 1 && (--ft_copy.end())->second == "five" && ++ft_copy.begin() == ft_copy.end());
+		ft_other.clear();
+		threaded_check(ft_other, std::map<int, std::string>());
+		ft_other[1] = "one";
+		assert(--ft_other.end() == ft_other.begin());
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		print_break("Set");
+		ft::set<int>	ft_s;
+		std::set<int>	std_s;
+		for (int i = 0; i < 2000; i++)
+		{
+			int	key = rand() % 3000;
+			ft_s.insert(key);
+			std_s.insert(key);
+			if (i % 3 == 0 && ft_s.size() > 2)
+			{
+				ft_s.erase(ft_s.begin());
+				std_s.erase(std_s.begin());
+				ft_s.erase(--ft_s.end());
+				std_s.erase(--std_s.end());
+			}
+		}
+		threaded_check(ft_s, std_s);
+		ft::set<int>	ft_sorted(ft::sorted_unique, std_s.begin(), std_s.end());
+		threaded_check(ft_sorted, std_s);
+		ft_sorted = ft_s;
+		threaded_check(ft_sorted, std_s);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		double						ft_elapsed_time, std_elapsed_time, start_time;
+		ft::map<int, int>			ft_m;
+		std::map<int, int>			std_m;
+		long						ft_sum = 0, walk_sum = 0, std_sum = 0;
+		typedef ft::map<int, int>::const_iterator::leaf_node_pointer	leaf_node_pointer;
+		typedef ft::map<int, int>::const_iterator::node_pointer			node_pointer;
+		print_break("Performance");
+		srand(7);
+		for (int i = 0; i < ENTRIES; i++)
+		{
+			int	key = rand();
+			ft_m[key] = i;
+			std_m[key] = i;
+			if (i % 2)
+			{
+				key = rand();
+				ft_m.erase(key);
+				std_m.erase(key);
+			}
+		}
+		std::cout << "Scanning " << ft_m.size() << " entries " << SCANS << " times" << std::endl;
+
+		start_time = wall_time();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (ft::map<int, int>::const_iterator it = ft_m.begin(); it != ft_m.end(); ++it)
+				ft_sum += it->second;
+		ft_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (threaded) elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = wall_time();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (leaf_node_pointer pos = ft_m.begin().base(); pos != ft_m.end().base(); pos = ft::iter_to_next<leaf_node_pointer>(static_cast<node_pointer>(pos)))
+				walk_sum += static_cast<node_pointer>(pos)->_value.second;
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "ft (parent walk) elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == walk_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+
+		start_time = wall_time();
+		for (int scan = 0; scan < SCANS; scan++)
+			for (std::map<int, int>::const_iterator it = std_m.begin(); it != std_m.end(); ++it)
+				std_sum += it->second;
+		std_elapsed_time = wall_time() - start_time;
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		assert(ft_sum == std_sum);
+		std::cout << "Faster by: " << std_elapsed_time / ft_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Threaded_rbtree OK");
+	}
+	return (0);
+}
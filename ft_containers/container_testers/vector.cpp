@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/21 15:20:25 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/23 22:17:27 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 12:44:30 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,6 +16,8 @@
 #include <cassert>
 #include <vector>
 #include <chrono>
+#include <sstream>
+#include <iterator>
 
 template <class T>
 void	ft_vector_print(ft::vector<T> const &v)
@@ -56,6 +58,16 @@ void	print_break(std::string text)
 	std::cout << "\n" << std::endl;
 }
 
+bool	is_odd(int n)
+{
+	return (n % 2 != 0);
+}
+
+bool	is_empty_or_long(std::string const &s)
+{
+	return (s.empty() || s.length() > 2);
+}
+
 template <class T>
 void	vector_check(ft::vector<T> const &ft_v, std::vector<T> const &std_v)
 {
@@ -71,8 +83,111 @@ void	vector_check(ft::vector<T> const &ft_v, std::vector<T> const &std_v)
 	}
 }
 
+/* Compares elements and size only, for the sections that run before the capacity checks */
+template <class T>
+void	vector_content_check(ft::vector<T> const &ft_v, std::vector<T> const &std_v)
+{
+	ft_vector_print(ft_v);
+	assert(ft_v.size() == std_v.size());
+	for (size_t i = 0; i < std_v.size(); i++)
+		assert(ft_v[i] == std_v[i]);
+}
+
 int	main(void)
 {
+	{
+		print_break("Erase_if");
+		ft::vector<int>			ft_v1;
+		std::vector<int>		std_v1;
+		for (int i = 0; i < 40; i++)
+		{
+			ft_v1.push_back(i * 7 % 11);
+			std_v1.push_back(i * 7 % 11);
+		}
+		const size_t	odd = std::count_if(std_v1.begin(), std_v1.end(), is_odd);
+		assert(ft::erase_if(ft_v1, is_odd) == odd);
+		std_v1.erase(std::remove_if(std_v1.begin(), std_v1.end(), is_odd), std_v1.end());
+		vector_content_check(ft_v1, std_v1);
+		assert(ft::erase_if(ft_v1, is_odd) == 0);
+		vector_content_check(ft_v1, std_v1);
+
+		ft::vector<std::string>		ft_s1;
+		std::vector<std::string>	std_s1;
+		for (int i = 0; i < 20; i++)
+		{
+			ft_s1.push_back(std::string(i % 4 + 1, 'a' + i));
+			std_s1.push_back(std::string(i % 4 + 1, 'a' + i));
+		}
+		ft::erase_if(ft_s1, is_empty_or_long);
+		std_s1.erase(std::remove_if(std_s1.begin(), std_s1.end(), is_empty_or_long), std_s1.end());
+		vector_content_check(ft_s1, std_s1);
+
+		print_break("Erase_indices");
+		const size_t	indices[] = {0, 3, 3, 4, 9};
+		ft_v1.erase_indices(indices, indices + 5);
+		for (int i = 4; i >= 0; i--)
+			if (i == 0 || indices[i] != indices[i - 1])
+				std_v1.erase(std_v1.begin() + indices[i]);
+		vector_content_check(ft_v1, std_v1);
+		ft_v1.erase_indices(indices, indices);
+		vector_content_check(ft_v1, std_v1);
+
+		print_break("Unordered_erase");
+		ft::vector<int>::iterator	hole = ft_v1.unordered_erase(ft_v1.begin() + 2);
+		std_v1[2] = std_v1.back();
+		std_v1.pop_back();
+		assert(hole == ft_v1.begin() + 2);
+		vector_content_check(ft_v1, std_v1);
+		hole = ft_v1.unordered_erase(ft_v1.end() - 1);
+		std_v1.pop_back();
+		assert(hole == ft_v1.end());
+		vector_content_check(ft_v1, std_v1);
+	}
+	{
+		print_break("Input iterators");
+		std::istringstream				ft_in("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17");
+		std::istringstream				std_in("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17");
+		ft::vector<int>					ft_in_v((std::istream_iterator<int>(ft_in)), std::istream_iterator<int>());
+		std::vector<int>				std_in_v((std::istream_iterator<int>(std_in)), std::istream_iterator<int>());
+		vector_content_check(ft_in_v, std_in_v);
+
+		ft_in.clear();
+		ft_in.str("-1 -2 -3");
+		std_in.clear();
+		std_in.str("-1 -2 -3");
+		ft_in_v.assign(std::istream_iterator<int>(ft_in), std::istream_iterator<int>());
+		std_in_v.assign(std::istream_iterator<int>(std_in), std::istream_iterator<int>());
+		vector_content_check(ft_in_v, std_in_v);
+
+		ft_in.clear();
+		ft_in.str("7 8 9 10 11");
+		std_in.clear();
+		std_in.str("7 8 9 10 11");
+		ft_in_v.insert(ft_in_v.end(), std::istream_iterator<int>(ft_in), std::istream_iterator<int>());
+		std_in_v.insert(std_in_v.end(), std::istream_iterator<int>(std_in), std::istream_iterator<int>());
+		vector_content_check(ft_in_v, std_in_v);
+
+		ft_in.clear();
+		ft_in.str("100 200");
+		std_in.clear();
+		std_in.str("100 200");
+		ft_in_v.reserve(100);
+		std_in_v.reserve(100);
+		ft_in_v.insert(ft_in_v.begin() + 1, std::istream_iterator<int>(ft_in), std::istream_iterator<int>());
+		std_in_v.insert(std_in_v.begin() + 1, std::istream_iterator<int>(std_in), std::istream_iterator<int>());
+		vector_content_check(ft_in_v, std_in_v);
+
+		std::ostringstream				many;
+		for (int i = 0; i < 150; i++)
+			many << i * 3 << " ";
+		ft_in.clear();
+		ft_in.str(many.str());
+		std_in.clear();
+		std_in.str(many.str());
+		ft_in_v.insert(ft_in_v.begin() + 2, std::istream_iterator<int>(ft_in), std::istream_iterator<int>());
+		std_in_v.insert(std_in_v.begin() + 2, std::istream_iterator<int>(std_in), std::istream_iterator<int>());
+		vector_content_check(ft_in_v, std_in_v);
+	}
 	{
 		print_break("Constructors");
 		ft::vector<int> 					ft_v1;
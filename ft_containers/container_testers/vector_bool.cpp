@@ -0,0 +1,223 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bool.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:47:05 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 14:31:48 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../srcs/vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+#define IDS		(1 << 26)
+#define SCANS	20
+
+void	ft_vector_bool_print(ft::vector<bool> const &vec)
+{
+	std::cout << "Size: " << vec.size() << std::endl;
+	std::cout << "Capacity: " << vec.capacity() << std::endl;
+	std::cout << "Content: " << std::endl;
+	for (ft::vector<bool>::const_iterator it = vec.begin(); it != vec.end(); it++)
+		std::cout << *it;
+	std::cout << "\n" << std::endl;
+}
+
+void	print_break(std::string text)
+{
+	int	count = (75 - text.length()) / 2;
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << " " << text << " ";
+	for (int i = 0; i < count; i++)
+		std::cout << "-";
+	std::cout << "\n" << std::endl;
+}
+
+bool	is_set(bool bit)
+{
+	return (bit);
+}
+
+void	vector_bool_check(ft::vector<bool> const &ft_vec, std::vector<bool> const &std_vec)
+{
+	ft_vector_bool_print(ft_vec);
+	assert(ft_vec.empty() == std_vec.empty());
+	assert(ft_vec.size() == std_vec.size());
+	assert(ft_vec.capacity() >= ft_vec.size());
+	std::size_t	set = 0;
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		assert(ft_vec[i] == std_vec[i]);
+		set += std_vec[i];
+	}
+	assert(ft_vec.count() == set);
+	ft::vector<bool>::const_reverse_iterator	ft_rit = ft_vec.rbegin();
+	std::vector<bool>::const_reverse_iterator	std_rit = std_vec.rbegin();
+	for (; std_rit != std_vec.rend(); ft_rit++, std_rit++)
+		assert(*ft_rit == *std_rit);
+	assert(ft_rit == ft_vec.rend());
+	std::size_t	pos = ft_vec.find_first();
+	for (std::size_t i = 0; i < std_vec.size(); i++)
+	{
+		if (std_vec[i] == false)
+			continue ;
+		assert(pos == i);
+		pos = ft_vec.find_next(pos);
+	}
+	assert(pos == ft_vec.size());
+}
+
+int	main(void)
+{
+	{
+		print_break("Constructors");
+		std::vector<bool>	std_v1;
+		std::vector<bool>	std_v2(70, true);
+		std::vector<bool>	std_v3;
+		for (int i = 0; i < 150; i++)
+			std_v3.push_back(i % 3 == 0 || i % 7 == 0);
+
+		ft::vector<bool>	ft_v1;
+		ft::vector<bool>	ft_v2(70, true);
+		ft::vector<bool>	ft_v3(std_v3.begin(), std_v3.end());
+		ft::vector<bool>	ft_v4(ft_v3);
+		ft::vector<bool>	ft_v5(ft_v3.rbegin(), ft_v3.rend());
+
+		vector_bool_check(ft_v1, std_v1);
+		vector_bool_check(ft_v2, std_v2);
+		vector_bool_check(ft_v3, std_v3);
+		vector_bool_check(ft_v4, std_v3);
+		vector_bool_check(ft_v5, std::vector<bool>(std_v3.rbegin(), std_v3.rend()));
+		assert(ft_v3.capacity() < 8 * sizeof(bool) * 150);
+
+		print_break("Proxy references");
+		ft_v4[0] = false;
+		ft_v4[1] = ft_v4[3];
+		ft_v4.back().flip();
+		assert(~ft_v4[2] == true);
+		ft::vector<bool>::swap(ft_v4[5], ft_v4[6]);
+		*(ft_v4.begin() + 64) = true;
+		std_v3[0] = false;
+		std_v3[1] = std_v3[3];
+		std_v3.back().flip();
+		std::vector<bool>::swap(std_v3[5], std_v3[6]);
+		std_v3[64] = true;
+		vector_bool_check(ft_v4, std_v3);
+
+		print_break("Push_back / Insert / Erase");
+		for (int i = 0; i < 130; i++)
+		{
+			ft_v1.push_back(i % 5 == 1);
+			std_v1.push_back(i % 5 == 1);
+		}
+		ft_v1.insert(ft_v1.begin() + 3, true);
+		std_v1.insert(std_v1.begin() + 3, true);
+		ft_v1.insert(ft_v1.begin() + 60, 70, true);
+		std_v1.insert(std_v1.begin() + 60, 70, true);
+		ft_v1.insert(ft_v1.begin() + 10, std_v3.begin(), std_v3.begin() + 40);
+		std_v1.insert(std_v1.begin() + 10, std_v3.begin(), std_v3.begin() + 40);
+		vector_bool_check(ft_v1, std_v1);
+		ft_v1.erase(ft_v1.begin() + 20, ft_v1.begin() + 150);
+		std_v1.erase(std_v1.begin() + 20, std_v1.begin() + 150);
+		ft_v1.erase(ft_v1.begin());
+		std_v1.erase(std_v1.begin());
+		ft_v1.pop_back();
+		std_v1.pop_back();
+		vector_bool_check(ft_v1, std_v1);
+
+		print_break("Resize / Flip / Assign");
+		ft_v1.resize(65);
+		std_v1.resize(65);
+		vector_bool_check(ft_v1, std_v1);
+		ft_v1.resize(140, true);
+		std_v1.resize(140, true);
+		ft_v1.flip();
+		std_v1.flip();
+		vector_bool_check(ft_v1, std_v1);
+		ft_v2.assign(3, true);
+		std_v2.assign(3, true);
+		vector_bool_check(ft_v2, std_v2);
+
+		print_break("Bitwise operators");
+		ft::vector<bool>	ft_a(ft_v3);
+		ft::vector<bool>	ft_b(150, false);
+		std::vector<bool>	std_a(ft_v3.begin(), ft_v3.end());
+		for (int i = 0; i < 150; i += 2)
+			ft_b[i] = true;
+		ft_a &= ft_b;
+		for (int i = 0; i < 150; i++)
+			std_a[i] = std_a[i] && i % 2 == 0;
+		vector_bool_check(ft_a, std_a);
+		ft_a |= ft_v3;
+		vector_bool_check(ft_a, std::vector<bool>(ft_v3.begin(), ft_v3.end()));
+		ft_a ^= ft_v3;
+		assert(ft_a.count() == 0 && ft_a.find_first() == ft_a.size());
+		try
+		{
+			ft_a &= ft_v1;
+			assert(false);
+		}
+		catch (std::invalid_argument &e)
+		{
+			std::cout << "Size mismatch caught\n" << std::endl;
+		}
+
+		print_break("Operators");
+		ft_v5 = ft_v3;
+		assert(ft_v5 == ft_v3 && ft_v5 <= ft_v3 && ft_v5 >= ft_v3);
+		ft_v5[149] = true;
+		assert(ft_v5 != ft_v3 && ft_v3 < ft_v5 && ft_v5 > ft_v3);
+		ft::swap(ft_v5, ft_v3);
+		assert(ft_v3[149] && ft_v5[149] == false);
+
+		print_break("Erase_if");
+		std::vector<bool>	std_v6(ft_v3.begin(), ft_v3.end());
+		const std::size_t	set = ft_v3.count();
+		assert(ft::erase_if(ft_v3, is_set) == set);
+		std_v6.erase(std::remove_if(std_v6.begin(), std_v6.end(), is_set), std_v6.end());
+		vector_bool_check(ft_v3, std_v6);
+		std::cout << "OK\n" << std::endl;
+	}
+	{
+		clock_t start_time, end_time;
+		double	ft_elapsed_time, std_elapsed_time;
+		std::size_t	ft_sum = 0, std_sum = 0;
+		print_break("Performance");
+
+		ft::vector<bool>	ft_ids(IDS, false);
+		std::vector<bool>	std_ids(IDS, false);
+		srand(42);
+		for (int i = 0; i < IDS / 16; i++)
+		{
+			const int	id = rand() % IDS;
+			ft_ids[id] = true;
+			std_ids[id] = true;
+		}
+
+		start_time = clock();
+		for (int scan = 0; scan < SCANS; scan++)
+			ft_sum += ft_ids.count();
+		end_time = clock();
+		ft_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		std::cout << "ft elapsed time: " << std::fixed << std::setprecision(6) << ft_elapsed_time << " seconds" << std::endl;
+
+		start_time = clock();
+		for (int scan = 0; scan < SCANS; scan++)
+			std_sum += std::count(std_ids.begin(), std_ids.end(), true);
+		end_time = clock();
+		std_elapsed_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+		assert(ft_sum == std_sum);
+		std::cout << "std elapsed time: " << std::fixed << std::setprecision(6) << std_elapsed_time << " seconds" << std::endl;
+		std::cout << "Slower by: " << ft_elapsed_time / std_elapsed_time << "x times\n" << std::endl;
+		print_break("All test finished: Vector<bool> OK");
+	}
+	return (0);
+}
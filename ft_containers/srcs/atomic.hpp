@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   atomic.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:41 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ATOMIC_HPP
+# define ATOMIC_HPP
+
+# include <cstddef>
+
+/**
+ * https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html
+ * https://en.cppreference.com/w/cpp/atomic/memory_order
+ *
+ * The project is built as C++98, which has no <atomic>. These helpers wrap the
+ * __atomic builtins provided by GCC and Clang so the concurrent containers can
+ * share one spelling of each operation
+ */
+namespace ft
+{
+	/* Size of a cache line, used to keep hot shared variables apart */
+	static const std::size_t	cache_line_size = 64;
+
+	/* Memory orders understood by the helpers below */
+	enum memory_order
+	{
+		memory_order_relaxed = __ATOMIC_RELAXED,
+		memory_order_acquire = __ATOMIC_ACQUIRE,
+		memory_order_release = __ATOMIC_RELEASE,
+		memory_order_acq_rel = __ATOMIC_ACQ_REL,
+		memory_order_seq_cst = __ATOMIC_SEQ_CST
+	};
+
+	/* Atomically reads the value at ptr */
+	template <class T>
+	T	atomic_load(const T* ptr, memory_order order = memory_order_seq_cst)
+	{
+		return (__atomic_load_n(ptr, order));
+	}
+
+	/* Atomically writes value to ptr */
+	template <class T>
+	void	atomic_store(T* ptr, T value, memory_order order = memory_order_seq_cst)
+	{
+		__atomic_store_n(ptr, value, order);
+	}
+
+	/* Atomically replaces the value at ptr and returns the previous one */
+	template <class T>
+	T	atomic_exchange(T* ptr, T value, memory_order order = memory_order_seq_cst)
+	{
+		return (__atomic_exchange_n(ptr, value, order));
+	}
+
+	/* Replaces the value at ptr with desired if it equals expected. On failure, expected receives the current value */
+	template <class T>
+	bool	atomic_compare_exchange(T* ptr, T& expected, T desired, memory_order success = memory_order_seq_cst, memory_order failure = memory_order_seq_cst)
+	{
+		return (__atomic_compare_exchange_n(ptr, &expected, desired, true, success, failure));
+	}
+
+	/* Atomically adds value to ptr and returns the previous value */
+	template <class T>
+	T	atomic_fetch_add(T* ptr, T value, memory_order order = memory_order_seq_cst)
+	{
+		return (__atomic_fetch_add(ptr, value, order));
+	}
+
+	/* Atomically subtracts value from ptr and returns the previous value */
+	template <class T>
+	T	atomic_fetch_sub(T* ptr, T value, memory_order order = memory_order_seq_cst)
+	{
+		return (__atomic_fetch_sub(ptr, value, order));
+	}
+
+	/* Hints the processor that the caller is spinning on a shared variable */
+	inline void	cpu_relax()
+	{
+# if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+# endif
+	}
+}
+
+#endif
@@ -0,0 +1,275 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:41 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+# include <memory>
+# include "atomic.hpp"
+
+/**
+ * https://en.wikipedia.org/wiki/Treiber_stack
+ * https://en.wikipedia.org/wiki/ABA_problem#Tagged_state_reference
+ *
+ * Lock-free LIFO shared between threads. Both the stack and its list of
+ * recycled nodes are Treiber stacks whose head word packs a node pointer with
+ * a 16-bit modification tag:
+ *
+ *      63                              16 15             0
+ *     +----------------------------------+----------------+
+ *     |           node address           |      tag       |
+ *     +----------------------------------+----------------+
+ *
+ * User-space addresses on x86-64 and AArch64 fit in 48 bits, so the address is
+ * shifted up and the tag is bumped on every successful update. A thread that
+ * was preempted between reading the head and its compare-exchange therefore
+ * fails even if the same node was popped and pushed back meanwhile (ABA).
+ * Popped nodes are never returned to the allocator while the stack is alive,
+ * only to the recycled list, so reading the next pointer of a node that has
+ * just been taken by another thread is always safe
+ */
+namespace ft
+{
+	/* The tagged head word needs 64-bit pointers */
+	typedef char	concurrent_stack_requires_64_bit_pointers[sizeof(void*) == 8 && sizeof(unsigned long) == 8 ? 1 : -1];
+
+	/* Concurrent_stack class */
+	template <class T, class Allocator = std::allocator<T> >
+	class concurrent_stack
+	{
+		public:
+			/* Member types */
+			typedef T										value_type;
+			typedef Allocator								allocator_type;
+			typedef std::size_t								size_type;
+			typedef value_type&								reference;
+			typedef const value_type&						const_reference;
+
+		private:
+			/* Helper types */
+			struct	node
+			{
+				node*		_next;
+				value_type	_value;
+			};
+			typedef node*													node_pointer;
+			typedef unsigned long											tagged_type;
+			typedef typename allocator_type::template rebind<node>::other	node_allocator;
+
+		public:
+			/* Constructs an empty stack with the given allocator */
+			explicit	concurrent_stack(const allocator_type& alloc = allocator_type()) : _node_alloc(alloc), _value_alloc(alloc), _head(0), _free(0), _size(0) {};
+
+			/* Destructor. Must not race with any other member function */
+			~concurrent_stack()
+			{
+				node_pointer	ptr = unpack(this->_head);
+				node_pointer	next;
+
+				for (; ptr != NULL; ptr = next)
+				{
+					next = ptr->_next;
+					this->_value_alloc.destroy(&ptr->_value);
+					this->_node_alloc.deallocate(ptr, 1);
+				}
+				for (ptr = unpack(this->_free); ptr != NULL; ptr = next)
+				{
+					next = ptr->_next;
+					this->_node_alloc.deallocate(ptr, 1);
+				}
+			};
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_value_alloc);
+			};
+
+			/* Capacity: Checks if the stack has no elements at the time of the call */
+			bool	empty() const
+			{
+				return (unpack(atomic_load(&this->_head, memory_order_acquire)) == NULL);
+			};
+
+			/* Capacity: Returns a snapshot of the number of elements, which may be stale by the time it is used */
+			size_type	size() const
+			{
+				return (atomic_load(&this->_size, memory_order_relaxed));
+			};
+
+			/* Modifiers: Pushes the given element value to the top of the stack */
+			void	push(const value_type& value)
+			{
+				node_pointer	ptr = this->make_node(value);
+
+				this->push_chain(this->_head, ptr, ptr);
+				atomic_fetch_add(&this->_size, size_type(1), memory_order_relaxed);
+			};
+
+			/* Modifiers: Pushes the elements of range [first, last) with a single update of the head, last element on top */
+			template <class InputIt>
+			void	push_range(InputIt first, InputIt last)
+			{
+				node_pointer	top = NULL;
+				node_pointer	bottom = NULL;
+				size_type		count = 0;
+
+				try
+				{
+					for (; first != last; ++first, ++count)
+					{
+						node_pointer	ptr = this->make_node(*first);
+						ptr->_next = top;
+						top = ptr;
+						if (bottom == NULL)
+							bottom = ptr;
+					}
+				}
+				catch (...)
+				{
+					for (node_pointer ptr = top; ptr != NULL; ptr = ptr->_next)
+						this->_value_alloc.destroy(&ptr->_value);
+					if (top != NULL)
+						this->push_chain(this->_free, top, bottom);
+					throw ;
+				}
+				if (top == NULL)
+					return ;
+				this->push_chain(this->_head, top, bottom);
+				atomic_fetch_add(&this->_size, count, memory_order_relaxed);
+			}
+
+			/* Modifiers: Moves the top element into value and removes it. Returns false if the stack was empty */
+			bool	try_pop(value_type& value)
+			{
+				node_pointer	ptr = this->pop_node(this->_head);
+
+				if (ptr == NULL)
+					return (false);
+				atomic_fetch_sub(&this->_size, size_type(1), memory_order_relaxed);
+				try
+				{
+					value = ptr->_value;
+				}
+				catch (...)
+				{
+					this->push_chain(this->_head, ptr, ptr);
+					atomic_fetch_add(&this->_size, size_type(1), memory_order_relaxed);
+					throw ;
+				}
+				this->_value_alloc.destroy(&ptr->_value);
+				this->push_chain(this->_free, ptr, ptr);
+				return (true);
+			};
+
+			/* Modifiers: Detaches every element with a single update of the head and writes them to out from top to bottom. Returns the number of elements */
+			template <class OutputIt>
+			size_type	pop_all(OutputIt out)
+			{
+				tagged_type		old = atomic_load(&this->_head, memory_order_relaxed);
+				node_pointer	top;
+				node_pointer	bottom = NULL;
+				size_type		count = 0;
+
+				while (unpack(old) != NULL && !atomic_compare_exchange(&this->_head, old, pack(NULL, old + 1), memory_order_acquire, memory_order_relaxed))
+					;
+				top = unpack(old);
+				if (top == NULL)
+					return (0);
+				for (node_pointer ptr = top; ptr != NULL; ptr = ptr->_next, ++count)
+				{
+					*out = ptr->_value;
+					++out;
+					this->_value_alloc.destroy(&ptr->_value);
+					bottom = ptr;
+				}
+				atomic_fetch_sub(&this->_size, count, memory_order_relaxed);
+				this->push_chain(this->_free, top, bottom);
+				return (count);
+			}
+
+		private:
+			/* Not copyable: the stack is shared by address between threads */
+			concurrent_stack(const concurrent_stack& other);
+			concurrent_stack&	operator=(const concurrent_stack& other);
+
+			/* Helper function: Packs a node address and a modification tag into one word */
+			static tagged_type	pack(node_pointer ptr, tagged_type tag)
+			{
+				return ((reinterpret_cast<tagged_type>(ptr) << 16) | (tag & 0xFFFF));
+			};
+
+			/* Helper function: Extracts the node address from a tagged word */
+			static node_pointer	unpack(tagged_type word)
+			{
+				return (reinterpret_cast<node_pointer>(word >> 16));
+			};
+
+			/* Helper function: Links the private chain [top ... bottom] on top of head with a single compare-exchange */
+			void	push_chain(tagged_type& head, node_pointer top, node_pointer bottom)
+			{
+				tagged_type	old = atomic_load(&head, memory_order_relaxed);
+
+				do
+					atomic_store(&bottom->_next, unpack(old), memory_order_relaxed);
+				while (!atomic_compare_exchange(&head, old, pack(top, old + 1), memory_order_release, memory_order_relaxed));
+			};
+
+			/* Helper function: Unlinks the top node of head, or returns NULL if the list is empty */
+			node_pointer	pop_node(tagged_type& head)
+			{
+				tagged_type		old = atomic_load(&head, memory_order_acquire);
+				node_pointer	top;
+
+				while ((top = unpack(old)) != NULL)
+				{
+					node_pointer	next = atomic_load(&top->_next, memory_order_relaxed);
+					if (atomic_compare_exchange(&head, old, pack(next, old + 1), memory_order_acquire, memory_order_acquire))
+						break ;
+					cpu_relax();
+				}
+				return (top);
+			};
+
+			/* Helper function: Takes a recycled node (or allocates one) and copy-constructs value into it */
+			node_pointer	make_node(const value_type& value)
+			{
+				node_pointer	ptr = this->pop_node(this->_free);
+
+				if (ptr == NULL)
+					ptr = this->_node_alloc.allocate(1);
+				try
+				{
+					this->_value_alloc.construct(&ptr->_value, value);
+				}
+				catch (...)
+				{
+					this->push_chain(this->_free, ptr, ptr);
+					throw ;
+				}
+				return (ptr);
+			};
+
+			/* Member objects. Each shared word sits on its own cache line */
+			node_allocator		_node_alloc;
+			allocator_type		_value_alloc;
+			char				_pad0[cache_line_size];
+			tagged_type			_head;
+			char				_pad1[cache_line_size];
+			tagged_type			_free;
+			char				_pad2[cache_line_size];
+			size_type			_size;
+			char				_pad3[cache_line_size];
+	};
+}
+
+#endif
@@ -0,0 +1,648 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:42:11 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 11:58:23 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_VECTOR_HPP
+# define CONCURRENT_VECTOR_HPP
+
+# include <new>
+# include <memory>
+# include <limits>
+# include <climits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "iterator.hpp"
+# include "algorithm.hpp"
+# include "atomic.hpp"
+
+/**
+ * https://oneapi-src.github.io/oneTBB/main/tbb_userguide/concurrent_vector_ug.html
+ *
+ * Vector that many threads can grow at once. Elements live in a fixed table
+ * of segments whose sizes double, so growing never moves an element and
+ * references stay valid:
+ *
+ *     segment 0: [0, 8)    segment 1: [8, 24)    segment 2: [24, 56)    ...
+ *
+ * push_back() and grow_by() reserve their slots with one atomic fetch-add,
+ * then install any missing segment with a compare-exchange; a thread that
+ * loses the race frees its segment and uses the winner's. Indexing is O(1)
+ * and lock-free. Appends, indexing and reserve() may run concurrently with
+ * each other; an element may only be read once the thread appending it is
+ * known to be done. The other modifiers and the destructor must not race
+ * with anything.
+ *
+ * A slot is counted in size() as soon as it is claimed. If its segment
+ * cannot be allocated or its constructor throws, the slot is recorded as
+ * broken. clear() and the destructor skip broken slots, and they must not
+ * be read
+ */
+namespace ft
+{
+	/* Random access iterator over a concurrent_vector, made of the container and an index */
+	template <class Container, class Value>
+	class concurrent_vector_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::random_access_iterator_tag			iterator_category;
+			typedef typename Container::value_type			value_type;
+			typedef typename Container::difference_type		difference_type;
+			typedef typename Container::size_type			size_type;
+			typedef Value&									reference;
+			typedef Value*									pointer;
+
+			/* Orthodox canonical form */
+			concurrent_vector_iterator() : _container(NULL), _index(0) {};
+			template <class C, class V> concurrent_vector_iterator(const concurrent_vector_iterator<C, V>& other) : _container(other.container()), _index(other.index()) {}
+			~concurrent_vector_iterator() {};
+			concurrent_vector_iterator&	operator=(const concurrent_vector_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_container = other._container;
+				this->_index = other._index;
+				return (*this);
+			};
+
+			/* Constructs an iterator to element index of container */
+			concurrent_vector_iterator(Container* container, size_type index) : _container(container), _index(index) {};
+
+			/* Returns the container and the index */
+			Container*	container() const
+			{
+				return (this->_container);
+			};
+
+			size_type	index() const
+			{
+				return (this->_index);
+			};
+
+			/* Accesses the pointed-to element */
+			reference	operator*() const
+			{
+				return ((*this->_container)[this->_index]);
+			};
+
+			pointer	operator->() const
+			{
+				return (&(*this->_container)[this->_index]);
+			};
+
+			/* Accesses an element by index */
+			reference	operator[](difference_type n) const
+			{
+				return ((*this->_container)[this->_index + n]);
+			};
+
+			/* Advances or decrements the iterator */
+			concurrent_vector_iterator&	operator++()
+			{
+				this->_index++;
+				return (*this);
+			};
+
+			concurrent_vector_iterator&	operator--()
+			{
+				this->_index--;
+				return (*this);
+			};
+
+			concurrent_vector_iterator	operator++(int)
+			{
+				return (concurrent_vector_iterator(this->_container, this->_index++));
+			};
+
+			concurrent_vector_iterator	operator--(int)
+			{
+				return (concurrent_vector_iterator(this->_container, this->_index--));
+			};
+
+			concurrent_vector_iterator	operator+(difference_type n) const
+			{
+				return (concurrent_vector_iterator(this->_container, this->_index + n));
+			};
+
+			concurrent_vector_iterator	operator-(difference_type n) const
+			{
+				return (concurrent_vector_iterator(this->_container, this->_index - n));
+			};
+
+			concurrent_vector_iterator&	operator+=(difference_type n)
+			{
+				this->_index += n;
+				return (*this);
+			};
+
+			concurrent_vector_iterator&	operator-=(difference_type n)
+			{
+				this->_index -= n;
+				return (*this);
+			};
+
+		private:
+			/* Member objects */
+			Container*	_container;
+			size_type	_index;
+	};
+
+	/* Compares the indices */
+	template <class C1, class V1, class C2, class V2>
+	bool	operator==(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() == rhs.index());
+	}
+
+	template <class C1, class V1, class C2, class V2>
+	bool	operator!=(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() != rhs.index());
+	}
+
+	template <class C1, class V1, class C2, class V2>
+	bool	operator<(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() < rhs.index());
+	}
+
+	template <class C1, class V1, class C2, class V2>
+	bool	operator<=(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() <= rhs.index());
+	}
+
+	template <class C1, class V1, class C2, class V2>
+	bool	operator>(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() > rhs.index());
+	}
+
+	template <class C1, class V1, class C2, class V2>
+	bool	operator>=(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (lhs.index() >= rhs.index());
+	}
+
+	/* Advances the iterator */
+	template <class C, class V>
+	concurrent_vector_iterator<C, V>	operator+(typename concurrent_vector_iterator<C, V>::difference_type n, const concurrent_vector_iterator<C, V>& it)
+	{
+		return (it + n);
+	}
+
+	/* Computes the distance between two iterators */
+	template <class C1, class V1, class C2, class V2>
+	typename concurrent_vector_iterator<C1, V1>::difference_type	operator-(const concurrent_vector_iterator<C1, V1>& lhs, const concurrent_vector_iterator<C2, V2>& rhs)
+	{
+		return (static_cast<typename concurrent_vector_iterator<C1, V1>::difference_type>(lhs.index() - rhs.index()));
+	}
+
+	/* Concurrent_vector class */
+	template <class T, class Allocator = std::allocator<T> >
+	class concurrent_vector
+	{
+		public:
+			/* Member types */
+			typedef T																value_type;
+			typedef Allocator														allocator_type;
+			typedef std::size_t														size_type;
+			typedef std::ptrdiff_t													difference_type;
+			typedef value_type&														reference;
+			typedef const value_type&												const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef concurrent_vector_iterator<concurrent_vector, value_type>		iterator;
+			typedef concurrent_vector_iterator<const concurrent_vector, const value_type>	const_iterator;
+			typedef	ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+		private:
+			/* The first segment holds 2^first_bits elements and every following one twice as many as the previous */
+			static const size_type	first_bits = 3;
+			static const size_type	word_bits = sizeof(size_type) * CHAR_BIT;
+			static const size_type	segment_count = word_bits - first_bits;
+
+			/* Claimed slots [first, last) that hold no element, kept in a lock-free list */
+			struct	broken_range
+			{
+				size_type		first;
+				size_type		last;
+				broken_range	*next;
+			};
+
+		public:
+			/* Default constructor */
+			concurrent_vector() : _alloc(allocator_type()), _size(0), _broken(NULL), _leak(false)
+			{
+				std::fill(this->_segments, this->_segments + segment_count, pointer(NULL));
+			};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	concurrent_vector(const allocator_type& alloc) : _alloc(alloc), _size(0), _broken(NULL), _leak(false)
+			{
+				std::fill(this->_segments, this->_segments + segment_count, pointer(NULL));
+			};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	concurrent_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _size(0), _broken(NULL), _leak(false)
+			{
+				std::fill(this->_segments, this->_segments + segment_count, pointer(NULL));
+				try
+				{
+					this->grow_by(count, value);
+				}
+				catch (...)
+				{
+					this->release();
+					throw ;
+				}
+			};
+
+			/* Copy constructor. Skips the broken slots of other. Must not race with appends to other */
+			concurrent_vector(const concurrent_vector& other) : _alloc(other._alloc), _size(0), _broken(NULL), _leak(false)
+			{
+				const size_type	size = other.size();
+
+				std::fill(this->_segments, this->_segments + segment_count, pointer(NULL));
+				try
+				{
+					for (size_type i = 0; i < size; i++)
+						if (other.is_live(i))
+							this->push_back(other[i]);
+				}
+				catch (...)
+				{
+					this->release();
+					throw ;
+				}
+			};
+
+			/* Destructor */
+			~concurrent_vector()
+			{
+				this->release();
+			};
+
+			/* Copy assignation operator */
+			concurrent_vector&	operator=(const concurrent_vector& other)
+			{
+				if (this == &other)
+					return (*this);
+				concurrent_vector	temp(other);
+				this->swap(temp);
+				return (*this);
+			};
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				size_type	offset;
+				size_type	k = locate(pos, offset);
+				return (atomic_load(&this->_segments[k], memory_order_acquire)[offset]);
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				size_type	offset;
+				size_type	k = locate(pos, offset);
+				return (atomic_load(&this->_segments[k], memory_order_acquire)[offset]);
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				return ((*this)[0]);
+			};
+
+			const_reference	front() const
+			{
+				return ((*this)[0]);
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				return ((*this)[this->size() - 1]);
+			};
+
+			const_reference	back() const
+			{
+				return ((*this)[this->size() - 1]);
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				return (iterator(this, 0));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this, 0));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				return (iterator(this, this->size()));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this, this->size()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of slots claimed so far, including those still being constructed and broken ones */
+			size_type	size() const
+			{
+				return (std::min(atomic_load(&this->_size, memory_order_acquire), this->max_size()));
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return (std::min(this->_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max()) - (size_type(1) << first_bits)));
+			};
+
+			/* Capacity: Allocates the segments needed to hold new_cap elements. Safe to call concurrently */
+			void	reserve(size_type new_cap)
+			{
+				size_type	offset;
+
+				if (new_cap > this->max_size())
+					throw std::length_error("Length error");
+				if (new_cap == 0)
+					return ;
+				for (size_type k = locate(new_cap - 1, offset) + 1; k > 0; k--)
+					this->install_segment(k - 1);
+			};
+
+			/* Capacity: Returns the number of elements the allocated segments can hold */
+			size_type	capacity() const
+			{
+				size_type	k = 0;
+
+				while (k < segment_count && atomic_load(&this->_segments[k], memory_order_acquire) != NULL)
+					k++;
+				return ((size_type(1) << (k + first_bits)) - (size_type(1) << first_bits));
+			};
+
+			/* Modifiers: Erases all elements from the container, forgets the broken slots and keeps the segments */
+			void	clear()
+			{
+				const size_type	size = this->size();
+
+				for (size_type i = 0; i < size; i++)
+					if (this->is_live(i))
+						this->_alloc.destroy(&(*this)[i]);
+				while (this->_broken != NULL)
+				{
+					broken_range	*next = this->_broken->next;
+					delete this->_broken;
+					this->_broken = next;
+				}
+				this->_leak = false;
+				this->_size = 0;
+			};
+
+			/* Modifiers: Appends a copy of value. Safe to call concurrently. Returns an iterator to the new element */
+			iterator	push_back(const value_type& value)
+			{
+				const size_type	index = this->claim(1);
+				size_type		offset;
+				size_type		k = locate(index, offset);
+
+				try
+				{
+					this->_alloc.construct(this->install_segment(k) + offset, value);
+				}
+				catch (...)
+				{
+					this->mark_broken(index, index + 1);
+					throw ;
+				}
+				return (iterator(this, index));
+			};
+
+			/* Modifiers: Appends count copies of value. Safe to call concurrently. Returns an iterator to the first new element */
+			iterator	grow_by(size_type count, const value_type& value = value_type())
+			{
+				const size_type	index = this->claim(count);
+				size_type		offset;
+				size_type		i = index;
+
+				if (count == 0)
+					return (iterator(this, index));
+				try
+				{
+					for (size_type k = locate(index, offset); k <= locate(index + count - 1, offset); k++)
+						this->install_segment(k);
+					for (; i < index + count; i++)
+						this->_alloc.construct(&(*this)[i], value);
+				}
+				catch (...)
+				{
+					this->mark_broken(i, index + count);
+					throw ;
+				}
+				return (iterator(this, index));
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(concurrent_vector& other)
+			{
+				std::swap_ranges(this->_segments, this->_segments + segment_count, other._segments);
+				std::swap(this->_size, other._size);
+				std::swap(this->_broken, other._broken);
+				std::swap(this->_leak, other._leak);
+			};
+
+		private:
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: Returns the number of elements of segment k */
+			static size_type	segment_size(size_type k)
+			{
+				return (size_type(1) << (k + first_bits));
+			};
+
+			/* Helper function: Returns the segment holding index and its offset within it */
+			static size_type	locate(size_type index, size_type& offset)
+			{
+				const size_type	value = index + (size_type(1) << first_bits);
+				const size_type	log = word_bits - 1 - __builtin_clzl(value);
+
+				offset = value - (size_type(1) << log);
+				return (log - first_bits);
+			};
+
+			/* Helper function: Allocates segment k unless another thread already did. Returns the installed segment */
+			pointer	install_segment(size_type k)
+			{
+				pointer	expected = atomic_load(&this->_segments[k], memory_order_acquire);
+				pointer	segment;
+
+				if (expected != NULL)
+					return (expected);
+				segment = this->_alloc.allocate(segment_size(k));
+				while (expected == NULL)
+				{
+					if (atomic_compare_exchange(&this->_segments[k], expected, segment, memory_order_acq_rel, memory_order_acquire))
+						return (segment);
+				}
+				this->_alloc.deallocate(segment, segment_size(k));
+				return (expected);
+			};
+
+			/* Helper function: Destroys the elements and frees every segment, including those after a segment that was never installed */
+			void	release()
+			{
+				this->clear();
+				for (size_type k = 0; k < segment_count; k++)
+					if (this->_segments[k] != NULL)
+						this->_alloc.deallocate(this->_segments[k], segment_size(k));
+			};
+
+			/* Helper function: Returns whether slot i holds an element. Never assumed once a broken slot could not be recorded */
+			bool	is_live(size_type i) const
+			{
+				if (this->_leak)
+					return (false);
+				for (const broken_range *range = this->_broken; range != NULL; range = range->next)
+					if (i >= range->first && i < range->last)
+						return (false);
+				return (true);
+			};
+
+			/**
+			 * Helper function: Records the claimed slots [first, last) as broken. Safe to call concurrently. If not even
+			 * the record can be allocated, no slot is trusted any more and clear() leaks the elements rather than destroy
+			 * slots that were never constructed
+			 */
+			void	mark_broken(size_type first, size_type last)
+			{
+				broken_range	*range = new (std::nothrow) broken_range;
+
+				if (range == NULL)
+				{
+					atomic_store(&this->_leak, true, memory_order_release);
+					return ;
+				}
+				range->first = first;
+				range->last = last;
+				range->next = atomic_load(&this->_broken, memory_order_acquire);
+				while (atomic_compare_exchange(&this->_broken, range->next, range, memory_order_acq_rel, memory_order_acquire) == false)
+					;
+			};
+
+			/* Helper function: Reserves count consecutive slots and returns the first one */
+			size_type	claim(size_type count)
+			{
+				size_type	index;
+
+				if (count > this->max_size())
+					throw std::length_error("Length error");
+				index = atomic_fetch_add(&this->_size, count, memory_order_acq_rel);
+				if (index > this->max_size() - count)
+				{
+					atomic_fetch_sub(&this->_size, count, memory_order_acq_rel);
+					throw std::length_error("Length error");
+				}
+				return (index);
+			};
+
+			/* Member objects. The counter is written by every appending thread, so it sits on its own cache line */
+			allocator_type	_alloc;
+			pointer			_segments[segment_count];
+			char			_pad0[cache_line_size];
+			size_type		_size;
+			char			_pad1[cache_line_size];
+			broken_range	*_broken;
+			bool			_leak;
+	};
+
+	/* Lexicographically compares the values in the vector */
+	template <class T, class Alloc>
+	bool	operator==(const concurrent_vector<T, Alloc>& lhs, const concurrent_vector<T, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const concurrent_vector<T, Alloc>& lhs, const concurrent_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, class Alloc>
+	void	swap(concurrent_vector<T, Alloc>& lhs, concurrent_vector<T, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
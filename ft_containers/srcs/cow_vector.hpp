@@ -0,0 +1,497 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cow_vector.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:31:06 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:05:12 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COW_VECTOR_HPP
+# define COW_VECTOR_HPP
+
+# include <memory>
+# include "vector.hpp"
+# include "atomic.hpp"
+
+/**
+ * https://doc.qt.io/qt-5/implicit-sharing.html
+ * https://en.wikipedia.org/wiki/Copy-on-write
+ *
+ * Vector whose copies share one reference-counted buffer, so copying or
+ * publishing a snapshot costs O(1). The first non-const access to a shared
+ * buffer clones it. The count is atomic, so copies of one vector may be read
+ * and written from different threads as long as each object is used by one
+ * thread at a time.
+ *
+ * As with Qt's containers, references and iterators obtained through
+ * non-const access must not be written through once the vector has been
+ * copied: the buffer they point into is shared from then on
+ */
+namespace ft
+{
+	/* Cow_vector class */
+	template <typename T, typename Allocator = std::allocator<T> >
+	class cow_vector
+	{
+		public:
+			/* Member types */
+			typedef ft::vector<T, Allocator>						vector_type;
+			typedef T												value_type;
+			typedef Allocator										allocator_type;
+			typedef typename vector_type::size_type					size_type;
+			typedef typename vector_type::difference_type			difference_type;
+			typedef typename vector_type::reference					reference;
+			typedef typename vector_type::const_reference			const_reference;
+			typedef typename vector_type::pointer					pointer;
+			typedef typename vector_type::const_pointer				const_pointer;
+			typedef typename vector_type::iterator					iterator;
+			typedef typename vector_type::const_iterator			const_iterator;
+			typedef typename vector_type::reverse_iterator			reverse_iterator;
+			typedef typename vector_type::const_reverse_iterator	const_reverse_iterator;
+
+		private:
+			/* Shared buffer: the elements and the number of cow_vectors using them */
+			struct	block
+			{
+				explicit	block(const allocator_type& alloc) : refs(1), data(alloc) {};
+
+				size_type	refs;
+				vector_type	data;
+			};
+
+			typedef typename allocator_type::template rebind<block>::other	block_allocator;
+
+		public:
+			/* Default constructor */
+			cow_vector() : _alloc(allocator_type())
+			{
+				this->_block = this->create_block();
+			};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	cow_vector(const allocator_type& alloc) : _alloc(alloc)
+			{
+				this->_block = this->create_block();
+			};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	cow_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+			{
+				vector_type	data(alloc);
+
+				data.reserve(count);
+				data.assign(count, value);
+				this->_block = this->create_block(data);
+			};
+
+			/* Constructs the container with the contents of the range */
+			template <class InputIt>
+			cow_vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+			{
+				vector_type	data(first, last, alloc);
+
+				this->_block = this->create_block(data);
+			}
+
+			/* Constructs the container with a copy of the contents of vec */
+			explicit	cow_vector(const vector_type& vec) : _alloc(vec.get_allocator())
+			{
+				vector_type	data(this->_alloc);
+
+				data.reserve(vec.capacity());
+				data.assign(vec.begin(), vec.end());
+				this->_block = this->create_block(data);
+			};
+
+			/* Copy constructor. Shares the buffer of other */
+			cow_vector(const cow_vector& other) : _alloc(other._alloc), _block(other._block)
+			{
+				atomic_fetch_add(&this->_block->refs, size_type(1), memory_order_relaxed);
+			};
+
+			/* Deconstructor */
+			~cow_vector()
+			{
+				this->release();
+			};
+
+			/* Copy assignation operator. Shares the buffer of other */
+			cow_vector&	operator=(const cow_vector& other)
+			{
+				if (this->_block == other._block)
+					return (*this);
+				atomic_fetch_add(&other._block->refs, size_type(1), memory_order_relaxed);
+				this->release();
+				this->_block = other._block;
+				return (*this);
+			};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const T& value)
+			{
+				this->detach();
+				this->_block->data.assign(count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->detach();
+				this->_block->data.assign(first, last);
+			}
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Returns the number of cow_vectors sharing this buffer */
+			size_type	use_count() const
+			{
+				return (atomic_load(&this->_block->refs, memory_order_acquire));
+			};
+
+			/* Returns the shared elements as a read-only ft::vector */
+			const vector_type&	get() const
+			{
+				return (this->_block->data);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->detach();
+				return (this->_block->data.at(pos));
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				return (this->get().at(pos));
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				this->detach();
+				return (this->_block->data[pos]);
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (this->get()[pos]);
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				this->detach();
+				return (this->_block->data.front());
+			};
+
+			const_reference	front() const
+			{
+				return (this->get().front());
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				this->detach();
+				return (this->_block->data.back());
+			};
+
+			const_reference	back() const
+			{
+				return (this->get().back());
+			};
+
+			/* Element access: Returns pointer to the underlying array serving as element storage */
+			pointer	data()
+			{
+				this->detach();
+				return (this->_block->data.data());
+			};
+
+			const_pointer	data() const
+			{
+				return (this->get().data());
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				this->detach();
+				return (this->_block->data.begin());
+			};
+
+			const_iterator	begin() const
+			{
+				return (this->get().begin());
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				this->detach();
+				return (this->_block->data.end());
+			};
+
+			const_iterator	end() const
+			{
+				return (this->get().end());
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->get().empty());
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (this->get().size());
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return (this->get().max_size());
+			};
+
+			/* Capacity: Increase the capacity of the vector (Allocation might be needed) to a value that's greator or equal to new_cap */
+			void	reserve(size_type new_cap)
+			{
+				this->detach();
+				this->_block->data.reserve(new_cap);
+			};
+
+			/* Capacity: Returns the number of elements that the container has currently allocated space for */
+			size_type	capacity() const
+			{
+				return (this->get().capacity());
+			};
+
+			/* Modifiers: Erases all elements from the container. A shared buffer is dropped instead of cloned */
+			void	clear()
+			{
+				if (this->use_count() != 1)
+				{
+					block	*empty = this->create_block();
+					this->release();
+					this->_block = empty;
+				}
+				else
+					this->_block->data.clear();
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const difference_type	index = this->detach(pos);
+				return (this->_block->data.insert(this->_block->data.begin() + index, value));
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				const difference_type	index = this->detach(pos);
+				this->_block->data.insert(this->_block->data.begin() + index, count, value);
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				const difference_type	index = this->detach(pos);
+				this->_block->data.insert(this->_block->data.begin() + index, first, last);
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				const difference_type	index = this->detach(pos);
+				return (this->_block->data.erase(this->_block->data.begin() + index));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			iterator	erase(iterator first, iterator last)
+			{
+				const difference_type	count = last - first;
+				const difference_type	index = this->detach(first);
+				return (this->_block->data.erase(this->_block->data.begin() + index, this->_block->data.begin() + index + count));
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				this->detach();
+				this->_block->data.push_back(value);
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->detach();
+				this->_block->data.pop_back();
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				this->detach();
+				this->_block->data.resize(count, value);
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(cow_vector& other)
+			{
+				std::swap(this->_block, other._block);
+			};
+
+		private:
+			/* Helper function: Allocates a block holding an empty vector, used only by this cow_vector */
+			block	*create_block()
+			{
+				block_allocator	alloc(this->_alloc);
+				block			*ptr = alloc.allocate(1);
+
+				try
+				{
+					alloc.construct(ptr, block(this->_alloc));
+				}
+				catch (...)
+				{
+					alloc.deallocate(ptr, 1);
+					throw ;
+				}
+				return (ptr);
+			};
+
+			/**
+			 * Helper function: Allocates a block and swaps the elements of data into it. Callers fill data first, so
+			 * a throwing copy of T or a failed allocation leaves no block behind
+			 */
+			block	*create_block(vector_type& data)
+			{
+				block	*ptr = this->create_block();
+
+				ptr->data.swap(data);
+				return (ptr);
+			};
+
+			/* Helper function: Drops this cow_vector's reference and frees the block when it was the last one */
+			void	release()
+			{
+				block_allocator	alloc(this->_alloc);
+
+				if (atomic_fetch_sub(&this->_block->refs, size_type(1), memory_order_acq_rel) != 1)
+					return ;
+				alloc.destroy(this->_block);
+				alloc.deallocate(this->_block, 1);
+			};
+
+			/* Helper function: Gives this cow_vector its own copy of a shared buffer before a write */
+			void	detach()
+			{
+				if (atomic_load(&this->_block->refs, memory_order_acquire) == 1)
+					return ;
+
+				vector_type	data(this->_alloc);
+
+				data.reserve(this->_block->data.capacity());
+				data.assign(this->_block->data.begin(), this->_block->data.end());
+
+				block	*clone = this->create_block(data);
+
+				this->release();
+				this->_block = clone;
+			};
+
+			/* Helper function: Detaches and returns the index of pos, which may point into the shared buffer */
+			difference_type	detach(iterator pos)
+			{
+				const difference_type	index = pos - this->_block->data.begin();
+				this->detach();
+				return (index);
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			block			*_block;
+	};
+
+	/* Lexicographically compares the values in the vector */
+	template <class T, class Alloc>
+	bool	operator==(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() == rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() != rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool	operator<(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() < rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() <= rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() > rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() >= rhs.get());
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, class Alloc>
+	void	swap(cow_vector<T, Alloc>& lhs, cow_vector<T, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eytzinger_algorithm.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:47:15 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 22:38:54 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EYTZINGER_ALGORITHM_HPP
+# define EYTZINGER_ALGORITHM_HPP
+
+# include <cstddef>
+
+/**
+ * https://arxiv.org/abs/1509.05053
+ * https://algorithmica.org/en/eytzinger
+ *
+ * Sorted elements laid out as an implicit complete binary search tree in
+ * breadth-first (Eytzinger) order, with 1-based indices stored at k - 1:
+ *
+ *                          1
+ *                  /              \
+ *                 2                3
+ *              /     \          /     \
+ *             4       5        6       7          ...
+ *
+ * 	1. The children of index k are 2k and 2k + 1, the parent is k / 2
+ * 	2. Every element in the subtree of 2k is not greater than k, every element in the subtree of 2k + 1 is not less
+ * 	3. Index 0 is no element, and stands for end
+ *
+ * A search for the first element that fails a predicate walks down from 1 and
+ * goes to k = 2k + pred(element), which compiles to a conditional add instead
+ * of a branch, so it never mispredicts. The sixteen descendants four levels
+ * below k are adjacent, so they are prefetched while k is compared. The path
+ * taken is kept in the bits of k, and the answer is where it last went left
+ */
+namespace ft
+{
+	/* Returns the index of the first element of n in order */
+	template <class Size>
+	Size	eytzinger_first(Size n)
+	{
+		Size	k = 1;
+
+		if (n == 0)
+			return (0);
+		while (2 * k <= n)
+			k = 2 * k;
+		return (k);
+	}
+
+	/* Returns the index of the last element of n in order */
+	template <class Size>
+	Size	eytzinger_last(Size n)
+	{
+		Size	k = 1;
+
+		if (n == 0)
+			return (0);
+		while (2 * k + 1 <= n)
+			k = 2 * k + 1;
+		return (k);
+	}
+
+	/* Returns the index following k in order, or 0 after the last one */
+	template <class Size>
+	Size	eytzinger_next(Size k, Size n)
+	{
+		if (2 * k + 1 <= n)
+		{
+			k = 2 * k + 1;
+			while (2 * k <= n)
+				k = 2 * k;
+			return (k);
+		}
+		while (k & 1)
+			k >>= 1;
+		return (k >> 1);
+	}
+
+	/* Returns the index preceding k in order, or the last one when k is 0 */
+	template <class Size>
+	Size	eytzinger_prev(Size k, Size n)
+	{
+		if (k == 0)
+			return (eytzinger_last(n));
+		if (2 * k <= n)
+		{
+			k = 2 * k;
+			while (2 * k + 1 <= n)
+				k = 2 * k + 1;
+			return (k);
+		}
+		while (k != 0 && (k & 1) == 0)
+			k >>= 1;
+		return (k >> 1);
+	}
+
+	/* Returns the 0-based position in order of index k in a perfect tree of 2^height - 1 elements */
+	template <class Size>
+	Size	eytzinger_rank(Size k, Size height)
+	{
+		const Size	depth = static_cast<Size>(sizeof(unsigned long) * 8 - 1 - __builtin_clzl(static_cast<unsigned long>(k)));
+
+		return ((2 * (k - (Size(1) << depth)) + 1) * (Size(1) << (height - 1 - depth)) - 1);
+	}
+
+	/* Prefetches the elements four levels below k, which are adjacent */
+	template <class T, class Size>
+	void	eytzinger_prefetch(const T *base, Size k)
+	{
+		__builtin_prefetch(reinterpret_cast<const char *>(base) + (16 * k - 1) * sizeof(T));
+	}
+
+	/* Returns the index of the first of the n elements at base, in order, for which pred is false, or 0 if there is none */
+	template <class T, class Size, class Predicate>
+	Size	eytzinger_partition_point(const T *base, Size n, Predicate pred)
+	{
+		Size	k = 1;
+
+		while (k <= n)
+		{
+			eytzinger_prefetch(base, k);
+			k = 2 * k + static_cast<Size>(pred(base[k - 1]) ? 1 : 0);
+		}
+		k >>= __builtin_ffsl(static_cast<long>(~k));
+		return (k);
+	}
+}
+
+#endif
@@ -0,0 +1,401 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_file.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:38:54 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 22:38:54 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_FILE_HPP
+# define FROZEN_FILE_HPP
+
+# include <cstddef>
+# include <cerrno>
+# include <cstring>
+# include <string>
+# include <vector>
+# include <algorithm>
+# include <stdexcept>
+# include <fcntl.h>
+# include <unistd.h>
+# include "mapped_file.hpp"
+# include "eytzinger_algorithm.hpp"
+
+/**
+ * http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ * https://man7.org/linux/man-pages/man2/pwrite.2.html
+ *
+ * Versioned on-disk format for the contents of a map or set of trivially
+ * copyable types, queried in place through a read-only mapping:
+ *
+ * 	1. A header with the sizes, section offsets and an FNV-1a checksum of each section
+ * 	2. The keys, sorted by the comparator, in one array
+ * 	3. The mapped values in the same order (empty for a set)
+ * 	4. An index: the first key of every block of keys that share a cache line, in Eytzinger order
+ *
+ * Every section starts on a cache line. A lookup searches the small index
+ * without branches to find the block, then binary searches the block, so a
+ * cold lookup touches about one line of keys. The writer fills the sections
+ * with pwrite in a single pass over the sorted input and writes the header
+ * last, so an interrupted write leaves a file that fails to open. Opening
+ * checks the header only; verify() reads everything and checks the checksums
+ */
+namespace ft
+{
+	/* The checksums and the header use 64-bit words */
+	typedef char	frozen_file_requires_64_bit_long[sizeof(unsigned long) == 8 ? 1 : -1];
+
+	/* Returns the FNV-1a hash of size bytes at data, continuing from hash */
+	inline unsigned long	fnv1a(const void *data, std::size_t size, unsigned long hash = 14695981039346656037UL)
+	{
+		const unsigned char	*bytes = static_cast<const unsigned char *>(data);
+
+		for (std::size_t i = 0; i < size; i++)
+			hash = (hash ^ bytes[i]) * 1099511628211UL;
+		return (hash);
+	}
+
+	/* Layout of the start of a frozen file */
+	struct	frozen_file_header
+	{
+		char			magic[8];
+		std::size_t		version;
+		std::size_t		key_size;
+		std::size_t		value_size;
+		std::size_t		size;
+		std::size_t		block_keys;
+		std::size_t		index_height;
+		std::size_t		keys_offset;
+		std::size_t		values_offset;
+		std::size_t		index_offset;
+		std::size_t		file_size;
+		unsigned long	keys_checksum;
+		unsigned long	values_checksum;
+		unsigned long	index_checksum;
+	};
+
+	/* Constants of the format */
+	const char			frozen_file_magic[8] = { 'f', 't', 'f', 'r', 'o', 'z', 'e', 'n' };
+	const std::size_t	frozen_file_version = 1;
+	const std::size_t	frozen_file_line = 64;
+
+	/* Frozen_file_layout struct: The header fields that follow from the sizes */
+	struct	frozen_file_layout
+	{
+		/* Computes the layout of size keys of key_size bytes and values of value_size bytes */
+		static frozen_file_header	make(std::size_t key_size, std::size_t value_size, std::size_t size)
+		{
+			frozen_file_header	header;
+			std::size_t			blocks;
+
+			std::memset(&header, 0, sizeof(header));
+			std::memcpy(header.magic, frozen_file_magic, sizeof(frozen_file_magic));
+			header.version = frozen_file_version;
+			header.key_size = key_size;
+			header.value_size = value_size;
+			header.size = size;
+			header.block_keys = key_size < frozen_file_line ? frozen_file_line / key_size : 1;
+			blocks = (size + header.block_keys - 1) / header.block_keys;
+			while (((std::size_t(1) << header.index_height) - 1) < blocks)
+				header.index_height++;
+			header.keys_offset = align(sizeof(frozen_file_header));
+			header.values_offset = align(header.keys_offset + size * key_size);
+			header.index_offset = align(header.values_offset + size * value_size);
+			header.file_size = header.index_offset + index_size(header) * key_size;
+			return (header);
+		};
+
+		/* Returns the number of entries in the index of header */
+		static std::size_t	index_size(const frozen_file_header& header)
+		{
+			return ((std::size_t(1) << header.index_height) - 1);
+		};
+
+		/* Returns the number of index blocks of header */
+		static std::size_t	blocks(const frozen_file_header& header)
+		{
+			return ((header.size + header.block_keys - 1) / header.block_keys);
+		};
+
+		/* Rounds offset up to a cache line */
+		static std::size_t	align(std::size_t offset)
+		{
+			return ((offset + frozen_file_line - 1) / frozen_file_line * frozen_file_line);
+		};
+	};
+
+	/* Frozen_file_writer class: Writes a frozen file from elements appended in sorted order */
+	class frozen_file_writer
+	{
+		public:
+			/* Creates or truncates path for exactly size elements */
+			frozen_file_writer(const char *path, std::size_t key_size, std::size_t value_size, std::size_t size)
+				: _header(frozen_file_layout::make(key_size, value_size, size)), _fd(-1), _appended(0),
+				_keys(_header.keys_offset), _values(_header.values_offset), _index(_header.index_offset)
+			{
+				this->_fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+				if (this->_fd == -1)
+					fail(path);
+			};
+
+			/* Closes the file. A file that was not finished has no header and fails to open */
+			~frozen_file_writer()
+			{
+				close(this->_fd);
+			};
+
+			/* Appends the next key and its value, which is ignored for a set */
+			void	append(const void *key, const void *value)
+			{
+				if (this->_appended == this->_header.size)
+					throw std::length_error("frozen_file: more elements than declared");
+				if (this->_appended % this->_header.block_keys == 0)
+					this->_samples.insert(this->_samples.end(), static_cast<const char *>(key), static_cast<const char *>(key) + this->_header.key_size);
+				this->_keys.write(this->_fd, key, this->_header.key_size);
+				if (this->_header.value_size != 0)
+					this->_values.write(this->_fd, value, this->_header.value_size);
+				this->_appended++;
+			};
+
+			/* Writes the index and then the header, and waits until the file is on disk */
+			void	finish()
+			{
+				const std::size_t	blocks = frozen_file_layout::blocks(this->_header);
+				const std::size_t	index_size = frozen_file_layout::index_size(this->_header);
+
+				if (this->_appended != this->_header.size)
+					throw std::runtime_error("frozen_file: fewer elements than declared");
+				for (std::size_t k = 1; k <= index_size; k++)
+				{
+					const std::size_t	block = std::min(eytzinger_rank(k, this->_header.index_height), blocks - 1);
+					this->_index.write(this->_fd, &this->_samples[block * this->_header.key_size], this->_header.key_size);
+				}
+				this->_keys.flush(this->_fd);
+				this->_values.flush(this->_fd);
+				this->_index.flush(this->_fd);
+				this->_header.keys_checksum = this->_keys.checksum;
+				this->_header.values_checksum = this->_values.checksum;
+				this->_header.index_checksum = this->_index.checksum;
+				if (ftruncate(this->_fd, static_cast<off_t>(this->_header.file_size)) == -1)
+					fail("ftruncate");
+				if (fdatasync(this->_fd) == -1)
+					fail("fdatasync");
+				write_all(this->_fd, &this->_header, sizeof(this->_header), 0);
+				if (fdatasync(this->_fd) == -1)
+					fail("fdatasync");
+			};
+
+		private:
+			/* Buffered sequential writer of one section */
+			struct	section
+			{
+				std::size_t			offset;
+				std::vector<char>	buffer;
+				unsigned long		checksum;
+
+				section(std::size_t start) : offset(start), checksum(fnv1a(NULL, 0)) { buffer.reserve(buffer_size); };
+
+				void	write(int fd, const void *data, std::size_t size)
+				{
+					if (buffer.size() + size > buffer_size)
+						flush(fd);
+					buffer.insert(buffer.end(), static_cast<const char *>(data), static_cast<const char *>(data) + size);
+					checksum = fnv1a(data, size, checksum);
+				};
+
+				void	flush(int fd)
+				{
+					if (buffer.empty())
+						return ;
+					write_all(fd, &buffer[0], buffer.size(), offset);
+					offset += buffer.size();
+					buffer.clear();
+				};
+			};
+
+			static const std::size_t	buffer_size = 1 << 16;
+
+			/* Not copyable: the file is owned by one object */
+			frozen_file_writer(const frozen_file_writer&);
+			frozen_file_writer&	operator=(const frozen_file_writer&);
+
+			/* Helper function: Throws std::runtime_error describing errno */
+			static void	fail(const std::string& what)
+			{
+				throw std::runtime_error("frozen_file: " + what + ": " + std::strerror(errno));
+			};
+
+			/* Helper function: Writes size bytes at offset, retrying short writes */
+			static void	write_all(int fd, const void *data, std::size_t size, std::size_t offset)
+			{
+				const char	*bytes = static_cast<const char *>(data);
+				ssize_t		written;
+
+				while (size > 0)
+				{
+					written = pwrite(fd, bytes, size, static_cast<off_t>(offset));
+					if (written == -1 && errno == EINTR)
+						continue ;
+					if (written == -1)
+						fail("pwrite");
+					bytes += written;
+					offset += static_cast<std::size_t>(written);
+					size -= static_cast<std::size_t>(written);
+				}
+			};
+
+			/* Private member variables */
+			frozen_file_header	_header;
+			int					_fd;
+			std::size_t			_appended;
+			std::vector<char>	_samples;
+			section				_keys;
+			section				_values;
+			section				_index;
+	};
+
+	/* Frozen_file class: A frozen file mapped read-only */
+	class frozen_file
+	{
+		public:
+			/* Maps path and checks that its header describes keys of key_size bytes and values of value_size bytes */
+			frozen_file(const char *path, std::size_t key_size, std::size_t value_size) : _file(path, false)
+			{
+				frozen_file_header	expected;
+
+				if (this->_file.size() < sizeof(frozen_file_header) || std::memcmp(this->header().magic, frozen_file_magic, sizeof(frozen_file_magic)) != 0)
+					throw std::runtime_error("frozen_file: invalid file");
+				if (this->header().version != frozen_file_version)
+					throw std::runtime_error("frozen_file: unsupported version");
+				expected = frozen_file_layout::make(key_size, value_size, this->header().size);
+				if (this->header().key_size != key_size
+					|| this->header().value_size != value_size
+					|| this->header().size > this->_file.size() / key_size
+					|| this->header().block_keys != expected.block_keys
+					|| this->header().index_height != expected.index_height
+					|| this->header().keys_offset != expected.keys_offset
+					|| this->header().values_offset != expected.values_offset
+					|| this->header().index_offset != expected.index_offset
+					|| this->header().file_size != expected.file_size
+					|| this->header().file_size != this->_file.size())
+					throw std::runtime_error("frozen_file: invalid file");
+			};
+
+			/* Returns the header */
+			const frozen_file_header&	header() const
+			{
+				return (*reinterpret_cast<const frozen_file_header *>(this->_file.data()));
+			};
+
+			/* Returns the start of the keys, values and index */
+			const char	*keys() const
+			{
+				return (this->_file.data() + this->header().keys_offset);
+			};
+
+			const char	*values() const
+			{
+				return (this->_file.data() + this->header().values_offset);
+			};
+
+			const char	*index() const
+			{
+				return (this->_file.data() + this->header().index_offset);
+			};
+
+			/* Reads every section and returns whether the checksums match */
+			bool	verify() const
+			{
+				const frozen_file_header&	header = this->header();
+
+				return (fnv1a(this->keys(), header.size * header.key_size) == header.keys_checksum
+					&& fnv1a(this->values(), header.size * header.value_size) == header.values_checksum
+					&& fnv1a(this->index(), frozen_file_layout::index_size(header) * header.key_size) == header.index_checksum);
+			};
+
+			/* Returns the position of the first key not less than key, or size */
+			template <class Key, class Compare>
+			std::size_t	lower_bound(const Key& key, Compare comp) const
+			{
+				const Key	*keys = reinterpret_cast<const Key *>(this->keys());
+				std::size_t	first;
+				std::size_t	last;
+
+				if (!this->template find_block<Key>(first, last, before_key<Key, Compare>(comp, key)))
+					return (first);
+				return (std::lower_bound(keys + first, keys + last, key, comp) - keys);
+			}
+
+			/* Returns the position of the first key greater than key, or size */
+			template <class Key, class Compare>
+			std::size_t	upper_bound(const Key& key, Compare comp) const
+			{
+				const Key	*keys = reinterpret_cast<const Key *>(this->keys());
+				std::size_t	first;
+				std::size_t	last;
+
+				if (!this->template find_block<Key>(first, last, not_after_key<Key, Compare>(comp, key)))
+					return (first);
+				return (std::upper_bound(keys + first, keys + last, key, comp) - keys);
+			}
+
+		private:
+			/* Predicate: The key is less than key */
+			template <class Key, class Compare>
+			struct	before_key
+			{
+				Compare		comp;
+				const Key&	key;
+
+				before_key(Compare c, const Key& k) : comp(c), key(k) {};
+				bool	operator()(const Key& value) const { return (comp(value, key)); };
+			};
+
+			/* Predicate: The key is not greater than key */
+			template <class Key, class Compare>
+			struct	not_after_key
+			{
+				Compare		comp;
+				const Key&	key;
+
+				not_after_key(Compare c, const Key& k) : comp(c), key(k) {};
+				bool	operator()(const Key& value) const { return (!comp(key, value)); };
+			};
+
+			/* Not copyable: the mapping is owned by one object */
+			frozen_file(const frozen_file&);
+			frozen_file&	operator=(const frozen_file&);
+
+			/**
+			 * Helper function: Finds the first block whose first key fails pred. The answer is in the block before
+			 * it, so [first, last) is set to that block. Returns false, with first set to the answer, when it is
+			 * the first key
+			 */
+			template <class Key, class Predicate>
+			bool	find_block(std::size_t& first, std::size_t& last, Predicate pred) const
+			{
+				const frozen_file_header&	header = this->header();
+				std::size_t					block;
+
+				first = 0;
+				if (header.size == 0)
+					return (false);
+				block = eytzinger_partition_point(reinterpret_cast<const Key *>(this->index()), frozen_file_layout::index_size(header), pred);
+				block = (block == 0) ? frozen_file_layout::blocks(header) : eytzinger_rank(block, header.index_height);
+				if (block == 0)
+					return (false);
+				first = (block - 1) * header.block_keys;
+				last = std::min(block * header.block_keys, header.size);
+				return (true);
+			}
+
+			/* Private member variable */
+			mapped_file	_file;
+	};
+}
+
+#endif
@@ -0,0 +1,210 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:47:15 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 21:47:15 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_MAP_HPP
+# define FROZEN_MAP_HPP
+
+# include <memory>
+# include <stdexcept>
+# include <functional>
+# include "algorithm.hpp"
+# include "vt_compare.hpp"
+# include "frozen_tree.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/map
+ *
+ * Read-only map built once from pairs sorted by unique keys, usually by
+ * map::freeze(). The pairs are stored in one array in Eytzinger order, so
+ * lookups stay fast on maps much larger than the caches. There are no
+ * modifiers, and the mapped values cannot be changed either
+ */
+namespace ft
+{
+	/* Frozen_map class */
+	template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, T> > >
+	class frozen_map
+	{
+		public:
+			/* Member types */
+			typedef Key												key_type;
+			typedef T												mapped_type;
+			typedef pair<const Key, T>								value_type;
+			typedef std::size_t										size_type;
+			typedef std::ptrdiff_t									difference_type;
+			typedef Compare											key_compare;
+			typedef Allocator										allocator_type;
+			typedef value_type&										reference;
+			typedef const value_type&								const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+
+		private:
+			/* Helper types */
+			typedef vt_compare<key_type, value_type, key_compare>	value_compare_type;
+			typedef frozen_tree<value_type, value_compare_type, Allocator>	base;
+
+		public:
+			/* Member types */
+			typedef typename base::const_iterator					iterator;
+			typedef typename base::const_iterator					const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+			/* Default constructor */
+			frozen_map() : _tree(value_compare_type(), allocator_type()) {};
+
+			/* Constructs the container from the range [first, last), which must be sorted by comp and hold no equivalent keys */
+			template <class ForwardIt>
+			frozen_map(ForwardIt first, ForwardIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(first, last, value_compare_type(comp), alloc) {}
+
+			/* Copy constructor */
+			frozen_map(const frozen_map& other) : _tree(other._tree) {};
+
+			/* Destructor */
+			~frozen_map() {};
+
+			/* Copy assignation operator */
+			frozen_map&	operator=(const frozen_map& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_tree = other._tree;
+				return (*this);
+			};
+
+			/* Returns the associated allocator */
+			allocator_type	get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			};
+
+			/* Element access: Access specified element with bounds checking */
+			const T&	at(const key_type& key) const
+			{
+				const_iterator	it = this->find(key);
+				if (it == this->end())
+					throw std::out_of_range("Out of range");
+				return (it->second);
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			const_iterator	begin() const
+			{
+				return (this->_tree.begin());
+			};
+
+			/* Iterators: Returns an iterator to the end */
+			const_iterator	end() const
+			{
+				return (this->_tree.end());
+			};
+
+			/* Iterators: Returns a reverse iterator to the beginning */
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the end */
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->_tree.size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_tree.size());
+			};
+
+			/* Capacity: Returns the maximum possible number of elements */
+			size_type	max_size() const
+			{
+				return (this->_tree.max_size());
+			};
+
+			/* Modifiers: Swaps the contents */
+			void	swap(frozen_map& other)
+			{
+				this->_tree.swap(other._tree);
+			};
+
+			/* Lookup: Returns the number of elements matching specific key */
+			size_type	count(const key_type& key) const
+			{
+				return (this->_tree.count(key));
+			};
+
+			/* Lookup: Finds element with specific key */
+			const_iterator	find(const key_type& key) const
+			{
+				return (this->_tree.find(key));
+			};
+
+			/* Lookup: Returns range of elements matching a specific key */
+			pair<const_iterator, const_iterator>	equal_range(const key_type& key) const
+			{
+				return (this->_tree.equal_range(key));
+			};
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			const_iterator	lower_bound(const key_type& key) const
+			{
+				return (this->_tree.lower_bound(key));
+			};
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			const_iterator	upper_bound(const key_type& key) const
+			{
+				return (this->_tree.upper_bound(key));
+			};
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_tree.value_comp().key_comp());
+			};
+
+		private:
+			/* Private member variables */
+			base	_tree;
+	};
+
+	/* Compares the values in the maps */
+	template <class Key, class T, class Compare, class Alloc>
+	bool	operator==(const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool	operator!=(const frozen_map<Key, T, Compare, Alloc>& lhs, const frozen_map<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class Key, class T, class Compare, class Alloc>
+	void	swap(frozen_map<Key, T, Compare, Alloc>& lhs, frozen_map<Key, T, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
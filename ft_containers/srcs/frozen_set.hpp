@@ -0,0 +1,203 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_set.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:47:15 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 21:47:15 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_SET_HPP
+# define FROZEN_SET_HPP
+
+# include <memory>
+# include <functional>
+# include "algorithm.hpp"
+# include "frozen_tree.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/set
+ *
+ * Read-only set built once from sorted unique keys, usually by set::freeze().
+ * The keys are stored in one array in Eytzinger order, so lookups stay fast
+ * on sets much larger than the caches. There are no modifiers
+ */
+namespace ft
+{
+	/* Frozen_set class */
+	template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+	class frozen_set
+	{
+		public:
+			/* Member types */
+			typedef Key												key_type;
+			typedef Key												value_type;
+			typedef std::size_t										size_type;
+			typedef std::ptrdiff_t									difference_type;
+			typedef Compare											key_compare;
+			typedef Compare											value_compare;
+			typedef Allocator										allocator_type;
+			typedef value_type&										reference;
+			typedef const value_type&								const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+
+		private:
+			/* Helper types */
+			typedef frozen_tree<value_type, value_compare, Allocator>	base;
+
+		public:
+			/* Member types */
+			typedef typename base::const_iterator					iterator;
+			typedef typename base::const_iterator					const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+			/* Default constructor */
+			frozen_set() : _tree(value_compare(), allocator_type()) {};
+
+			/* Constructs the container from the range [first, last), which must be sorted by comp and hold no equivalent keys */
+			template <class ForwardIt>
+			frozen_set(ForwardIt first, ForwardIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(first, last, comp, alloc) {}
+
+			/* Copy constructor */
+			frozen_set(const frozen_set& other) : _tree(other._tree) {};
+
+			/* Destructor */
+			~frozen_set() {};
+
+			/* Copy assignation operator */
+			frozen_set&	operator=(const frozen_set& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_tree = other._tree;
+				return (*this);
+			};
+
+			/* Returns the associated allocator */
+			allocator_type	get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			const_iterator	begin() const
+			{
+				return (this->_tree.begin());
+			};
+
+			/* Iterators: Returns an iterator to the end */
+			const_iterator	end() const
+			{
+				return (this->_tree.end());
+			};
+
+			/* Iterators: Returns a reverse iterator to the beginning */
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the end */
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->_tree.size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_tree.size());
+			};
+
+			/* Capacity: Returns the maximum possible number of elements */
+			size_type	max_size() const
+			{
+				return (this->_tree.max_size());
+			};
+
+			/* Modifiers: Swaps the contents */
+			void	swap(frozen_set& other)
+			{
+				this->_tree.swap(other._tree);
+			};
+
+			/* Lookup: Returns the number of elements matching specific key */
+			size_type	count(const key_type& key) const
+			{
+				return (this->_tree.count(key));
+			};
+
+			/* Lookup: Finds element with specific key */
+			const_iterator	find(const key_type& key) const
+			{
+				return (this->_tree.find(key));
+			};
+
+			/* Lookup: Returns range of elements matching a specific key */
+			pair<const_iterator, const_iterator>	equal_range(const key_type& key) const
+			{
+				return (this->_tree.equal_range(key));
+			};
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			const_iterator	lower_bound(const key_type& key) const
+			{
+				return (this->_tree.lower_bound(key));
+			};
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			const_iterator	upper_bound(const key_type& key) const
+			{
+				return (this->_tree.upper_bound(key));
+			};
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_tree.value_comp());
+			};
+
+			/* Observers: Returns the function that compares keys in objects of type value_type */
+			value_compare	value_comp() const
+			{
+				return (this->_tree.value_comp());
+			};
+
+		private:
+			/* Private member variables */
+			base	_tree;
+	};
+
+	/* Compares the values in the sets */
+	template <class Key, class Compare, class Alloc>
+	bool	operator==(const frozen_set<Key, Compare, Alloc>& lhs, const frozen_set<Key, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator!=(const frozen_set<Key, Compare, Alloc>& lhs, const frozen_set<Key, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class Key, class Compare, class Alloc>
+	void	swap(frozen_set<Key, Compare, Alloc>& lhs, frozen_set<Key, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,344 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_tree.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:47:15 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 11:26:10 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_TREE_HPP
+# define FROZEN_TREE_HPP
+
+# include <memory>
+# include <limits>
+# include <iterator>
+# include <algorithm>
+# include "iterator.hpp"
+# include "utility.hpp"
+# include "eytzinger_algorithm.hpp"
+
+/**
+ * Immutable search tree behind frozen_set and frozen_map. The elements of a
+ * sorted range without duplicates are copied once into a single array in
+ * Eytzinger order (see eytzinger_algorithm.hpp), so a lookup touches one
+ * array, prefetches ahead and runs without branches instead of chasing the
+ * nodes of a red-black tree around the heap. Iteration follows the implicit
+ * tree in order
+ */
+namespace ft
+{
+	/* Bidirectional iterator over the elements of a frozen tree in order */
+	template <class T>
+	class frozen_tree_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::bidirectional_iterator_tag	iterator_category;
+			typedef T								value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef const T&						reference;
+			typedef const T*						pointer;
+
+			/* Orthodox canonical form */
+			frozen_tree_iterator() : _base(NULL), _size(0), _index(0) {};
+			frozen_tree_iterator(const frozen_tree_iterator& other) : _base(other._base), _size(other._size), _index(other._index) {};
+			~frozen_tree_iterator() {};
+			frozen_tree_iterator&	operator=(const frozen_tree_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_base = other._base;
+				this->_size = other._size;
+				this->_index = other._index;
+				return (*this);
+			};
+
+			/* Constructor with the array, its size and the 1-based index of the element. Index 0 is end */
+			frozen_tree_iterator(pointer base, std::size_t size, std::size_t index) : _base(base), _size(size), _index(index) {};
+
+			/* Returns the 1-based Eytzinger index of the element */
+			std::size_t	index() const
+			{
+				return (this->_index);
+			};
+
+			/* Accesses the pointed-to element */
+			reference	operator*() const
+			{
+				return (this->_base[this->_index - 1]);
+			};
+
+			pointer	operator->() const
+			{
+				return (&this->_base[this->_index - 1]);
+			};
+
+			/* Advances or decrements the iterator */
+			frozen_tree_iterator&	operator++()
+			{
+				this->_index = eytzinger_next(this->_index, this->_size);
+				return (*this);
+			};
+
+			frozen_tree_iterator	operator++(int)
+			{
+				frozen_tree_iterator	it = *this;
+				++(*this);
+				return (it);
+			};
+
+			frozen_tree_iterator&	operator--()
+			{
+				this->_index = eytzinger_prev(this->_index, this->_size);
+				return (*this);
+			};
+
+			frozen_tree_iterator	operator--(int)
+			{
+				frozen_tree_iterator	it = *this;
+				--(*this);
+				return (it);
+			};
+
+			/* Compares the positions */
+			bool	operator==(const frozen_tree_iterator& other) const
+			{
+				return (this->_index == other._index);
+			};
+
+			bool	operator!=(const frozen_tree_iterator& other) const
+			{
+				return (this->_index != other._index);
+			};
+
+		private:
+			/* Private member variables */
+			pointer		_base;
+			std::size_t	_size;
+			std::size_t	_index;
+	};
+
+	/* Frozen tree class */
+	template <class T, class Compare, class Allocator>
+	class frozen_tree
+	{
+		public:
+			/* Member types */
+			typedef T												value_type;
+			typedef Allocator										allocator_type;
+			typedef Compare											value_compare;
+			typedef typename allocator_type::difference_type		difference_type;
+			typedef typename allocator_type::size_type				size_type;
+			typedef const value_type&								const_reference;
+			typedef typename allocator_type::const_pointer			const_pointer;
+			typedef frozen_tree_iterator<value_type>				const_iterator;
+
+			/* Constructs an empty tree */
+			frozen_tree(const value_compare& comp, const allocator_type& alloc) : _alloc(alloc), _comp(comp), _data(NULL), _size(0) {};
+
+			/* Constructs the tree from the sorted range [first, last), which holds no equivalent elements */
+			template <class ForwardIt>
+			frozen_tree(ForwardIt first, ForwardIt last, const value_compare& comp, const allocator_type& alloc) : _alloc(alloc), _comp(comp), _data(NULL), _size(0)
+			{
+				const size_type	count = static_cast<size_type>(std::distance(first, last));
+
+				if (count == 0)
+					return ;
+				this->_data = this->_alloc.allocate(count);
+				try
+				{
+					for (size_type k = eytzinger_first(count); k != 0; k = eytzinger_next(k, count), ++first)
+					{
+						this->_alloc.construct(this->_data + k - 1, *first);
+						this->_size++;
+					}
+				}
+				catch (...)
+				{
+					this->destroy(count);
+					throw ;
+				}
+				this->_size = count;
+			}
+
+			/* Copy constructor. Copies the array as it is laid out */
+			frozen_tree(const frozen_tree& other) : _alloc(other._alloc), _comp(other._comp), _data(NULL), _size(0)
+			{
+				if (other._size == 0)
+					return ;
+				this->_data = this->_alloc.allocate(other._size);
+				try
+				{
+					for (; this->_size < other._size; this->_size++)
+						this->_alloc.construct(this->_data + this->_size, other._data[this->_size]);
+				}
+				catch (...)
+				{
+					while (this->_size > 0)
+						this->_alloc.destroy(this->_data + --this->_size);
+					this->_alloc.deallocate(this->_data, other._size);
+					throw ;
+				}
+			};
+
+			/* Destructor */
+			~frozen_tree()
+			{
+				this->destroy(this->_size);
+			};
+
+			/* Copy assignation operator */
+			frozen_tree&	operator=(const frozen_tree& other)
+			{
+				if (this == &other)
+					return (*this);
+				frozen_tree	copy(other);
+				this->swap(copy);
+				return (*this);
+			};
+
+			/* Returns the associated allocator */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Iterators: Returns an iterator to the first element in order */
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->_data, this->_size, eytzinger_first(this->_size)));
+			};
+
+			/* Iterators: Returns an iterator past the last element */
+			const_iterator	end() const
+			{
+				return (const_iterator(this->_data, this->_size, 0));
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_size);
+			};
+
+			/* Capacity: Returns the maximum possible number of elements */
+			size_type	max_size() const
+			{
+				return (std::min(this->_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max())));
+			};
+
+			/* Modifiers: Swaps the contents */
+			void	swap(frozen_tree& other)
+			{
+				std::swap(this->_alloc, other._alloc);
+				std::swap(this->_comp, other._comp);
+				std::swap(this->_data, other._data);
+				std::swap(this->_size, other._size);
+			};
+
+			/* Lookup: Finds the element equivalent to key */
+			template <class Key>
+			const_iterator	find(const Key& key) const
+			{
+				const size_type	k = eytzinger_partition_point(this->_data, this->_size, before_key<Key>(this->_comp, key));
+
+				if (k == 0 || this->_comp(key, this->_data[k - 1]))
+					return (this->end());
+				return (const_iterator(this->_data, this->_size, k));
+			}
+
+			/* Lookup: Returns the number of elements equivalent to key */
+			template <class Key>
+			size_type	count(const Key& key) const
+			{
+				return (this->find(key) == this->end() ? 0 : 1);
+			}
+
+			/* Lookup: Returns an iterator to the first element not less than key */
+			template <class Key>
+			const_iterator	lower_bound(const Key& key) const
+			{
+				return (const_iterator(this->_data, this->_size, eytzinger_partition_point(this->_data, this->_size, before_key<Key>(this->_comp, key))));
+			}
+
+			/* Lookup: Returns an iterator to the first element greater than key */
+			template <class Key>
+			const_iterator	upper_bound(const Key& key) const
+			{
+				return (const_iterator(this->_data, this->_size, eytzinger_partition_point(this->_data, this->_size, not_after_key<Key>(this->_comp, key))));
+			}
+
+			/* Lookup: Returns the range of elements equivalent to key */
+			template <class Key>
+			pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				const_iterator	first = this->find(key);
+
+				if (first == this->end())
+					return (ft::make_pair(this->lower_bound(key), this->lower_bound(key)));
+				const_iterator	last = first;
+				return (ft::make_pair(first, ++last));
+			}
+
+			/* Observers: Returns the function that compares elements */
+			value_compare	value_comp() const
+			{
+				return (this->_comp);
+			};
+
+		private:
+			/* Predicate: The element is less than key */
+			template <class Key>
+			struct	before_key
+			{
+				const value_compare&	comp;
+				const Key&				key;
+
+				before_key(const value_compare& c, const Key& k) : comp(c), key(k) {};
+				bool	operator()(const value_type& value) const { return (comp(value, key)); };
+			};
+
+			/* Predicate: The element is not greater than key */
+			template <class Key>
+			struct	not_after_key
+			{
+				const value_compare&	comp;
+				const Key&				key;
+
+				not_after_key(const value_compare& c, const Key& k) : comp(c), key(k) {};
+				bool	operator()(const value_type& value) const { return (!comp(key, value)); };
+			};
+
+			/* Helper function: Destroys the constructed elements and frees the array of capacity elements */
+			void	destroy(size_type capacity)
+			{
+				if (this->_data == NULL)
+					return ;
+				if (this->_size == capacity)
+				{
+					for (size_type i = 0; i < this->_size; i++)
+						this->_alloc.destroy(this->_data + i);
+				}
+				else
+				{
+					for (size_type k = eytzinger_first(capacity); this->_size > 0; k = eytzinger_next(k, capacity), this->_size--)
+						this->_alloc.destroy(this->_data + k - 1);
+				}
+				this->_alloc.deallocate(this->_data, capacity);
+				this->_data = NULL;
+				this->_size = 0;
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			value_compare	_comp;
+			value_type		*_data;
+			size_type		_size;
+	};
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/14 15:36:55 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/21 14:11:37 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 03:57:41 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,14 +14,42 @@
 # define FT_CONTAINERS_HPP
 
 # include <iostream>
+# include "eytzinger_algorithm.hpp"
+# include "concurrent_vector.hpp"
+# include "mapped_frozen_map.hpp"
+# include "mapped_frozen_set.hpp"
 # include "rbtree_algorithm.hpp"
+# include "concurrent_stack.hpp"
 # include "vector_iterator.hpp"
 # include "rbtree_iterator.hpp"
+# include "heap_algorithm.hpp"
+# include "priority_queue.hpp"
+# include "persistent_map.hpp"
+# include "mapped_vector.hpp"
+# include "small_vector.hpp"
 # include "rbtree_types.hpp"
+# include "node_handle.hpp"
+# include "frozen_file.hpp"
+# include "frozen_tree.hpp"
+# include "mapped_file.hpp"
+# include "vector_bool.hpp"
 # include "type_traits.hpp"
+# include "frozen_set.hpp"
+# include "frozen_map.hpp"
+# include "vt_compare.hpp"
+# include "offset_ptr.hpp"
+# include "cow_vector.hpp"
+# include "gap_vector.hpp"
+# include "soa_vector.hpp"
+# include "mpmc_queue.hpp"
 # include "algorithm.hpp"
+# include "spsc_ring.hpp"
+# include "multimap.hpp"
+# include "multiset.hpp"
+# include "relocate.hpp"
 # include "iterator.hpp"
 # include "utility.hpp"
+# include "atomic.hpp"
 # include "vector.hpp"
 # include "rbtree.hpp"
 # include "stack.hpp"
@@ -0,0 +1,734 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gap_vector.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:54:37 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 10:14:36 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GAP_VECTOR_HPP
+# define GAP_VECTOR_HPP
+
+# include <memory>
+# include <limits>
+# include <cstring>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "type_traits.hpp"
+# include "algorithm.hpp"
+# include "iterator.hpp"
+
+/**
+ * https://en.wikipedia.org/wiki/Gap_buffer
+ *
+ * Sequence stored in one buffer with a movable hole (the gap) at the last
+ * edit point:
+ *
+ *     [ a b c d | . . . . . | e f g ]
+ *       _start   _gap_begin  _gap_end  _cap
+ *
+ * Inserting or erasing at the gap only moves the gap boundaries. Editing
+ * somewhere else first moves the gap there, which moves only the elements
+ * between the old and the new edit point, so edits clustered around a cursor
+ * are O(1) amortised. data() closes the gap by moving it to the end
+ */
+namespace ft
+{
+	/* Gap_iterator class. Skips over the gap of the buffer it points into */
+	template <typename Iter, typename Container>
+	class gap_iterator
+	{
+		public:
+			/* Member types */
+			typedef Iter												iterator_type;
+			typedef typename iterator_traits<Iter>::iterator_category	iterator_category;
+			typedef typename iterator_traits<Iter>::value_type			value_type;
+			typedef typename iterator_traits<Iter>::difference_type		difference_type;
+			typedef typename iterator_traits<Iter>::reference			reference;
+			typedef typename iterator_traits<Iter>::pointer				pointer;
+
+			/* Orthodox canonical form */
+			gap_iterator() : _iter(iterator_type()), _gap_begin(iterator_type()), _gap_end(iterator_type()) {};
+			template <class It> gap_iterator(const gap_iterator<It, typename enable_if<is_same<It, typename Container::pointer>::value, Container>::type>& iter) : _iter(iter.base()), _gap_begin(iter.gap_begin()), _gap_end(iter.gap_end()) {}
+			~gap_iterator() {};
+			gap_iterator&	operator=(const gap_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_iter = other._iter;
+				this->_gap_begin = other._gap_begin;
+				this->_gap_end = other._gap_end;
+				return (*this);
+			};
+
+			/* Constructs with the given position and the bounds of the gap */
+			gap_iterator(const iterator_type& iter, const iterator_type& gap_begin, const iterator_type& gap_end) : _iter(iter), _gap_begin(gap_begin), _gap_end(gap_end) {};
+
+			/* Base member function. Accesses the underlying iterator */
+			const iterator_type&	base() const
+			{
+				return (this->_iter);
+			};
+
+			/* Accesses the bounds of the gap */
+			const iterator_type&	gap_begin() const
+			{
+				return (this->_gap_begin);
+			};
+
+			const iterator_type&	gap_end() const
+			{
+				return (this->_gap_end);
+			};
+
+			/* Returns the position the iterator would have if the gap was closed */
+			iterator_type	logical() const
+			{
+				if (this->_iter >= this->_gap_end)
+					return (this->_iter - (this->_gap_end - this->_gap_begin));
+				return (this->_iter);
+			};
+
+			/* Accesses the pointed-to element */
+			reference	operator*() const
+			{
+				return (*this->_iter);
+			};
+
+			pointer	operator->() const
+			{
+				return (this->_iter);
+			};
+
+			/* Accesses an element by index */
+			reference	operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			};
+
+			/* Advances or decrements the iterator */
+			gap_iterator&	operator++()
+			{
+				if (++this->_iter == this->_gap_begin)
+					this->_iter = this->_gap_end;
+				return (*this);
+			};
+
+			gap_iterator&	operator--()
+			{
+				if (this->_iter == this->_gap_end)
+					this->_iter = this->_gap_begin;
+				this->_iter--;
+				return (*this);
+			};
+
+			gap_iterator	operator++(int)
+			{
+				gap_iterator	temp = *this;
+				++*this;
+				return (temp);
+			};
+
+			gap_iterator	operator--(int)
+			{
+				gap_iterator	temp = *this;
+				--*this;
+				return (temp);
+			};
+
+			gap_iterator	operator+(difference_type n) const
+			{
+				gap_iterator	temp = *this;
+				return (temp += n);
+			};
+
+			gap_iterator	operator-(difference_type n) const
+			{
+				gap_iterator	temp = *this;
+				return (temp += -n);
+			};
+
+			gap_iterator&	operator+=(difference_type n)
+			{
+				iterator_type	pos = this->logical() + n;
+				if (pos >= this->_gap_begin)
+					pos += this->_gap_end - this->_gap_begin;
+				this->_iter = pos;
+				return (*this);
+			};
+
+			gap_iterator&	operator-=(difference_type n)
+			{
+				return (*this += -n);
+			};
+
+		protected:
+			/* Member objects */
+			Iter	_iter;
+			Iter	_gap_begin;
+			Iter	_gap_end;
+	};
+
+	/* Compares the underlying iterators */
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator==(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() == rhs.base());
+	}
+
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator!=(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() != rhs.base());
+	}
+
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator<(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() < rhs.base());
+	}
+
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator<=(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() <= rhs.base());
+	}
+
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator>(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() > rhs.base());
+	}
+
+	template <class Iterator1, class Iterator2, class Container>
+	bool operator>=(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.base() >= rhs.base());
+	}
+
+	/* Advances the iterator */
+	template <class Iterator, class Container>
+	gap_iterator<Iterator, Container>	operator+(typename gap_iterator<Iterator, Container>::difference_type n, const gap_iterator<Iterator, Container>& it)
+	{
+		return (it + n);
+	}
+
+	/* Computes the distance between two iterators, not counting the gap */
+	template <class Iterator1, typename Iterator2, typename Container>
+	typename gap_iterator<Iterator1, Container>::difference_type	operator-(const gap_iterator<Iterator1, Container>& lhs, const gap_iterator<Iterator2, Container>& rhs)
+	{
+		return (lhs.logical() - rhs.logical());
+	}
+
+	/* Gap_vector class */
+	template <typename T, typename Allocator = std::allocator<T> >
+	class gap_vector
+	{
+		public:
+			/* Member types */
+			typedef T											value_type;
+			typedef Allocator									allocator_type;
+			typedef std::size_t									size_type;
+			typedef std::ptrdiff_t								difference_type;
+			typedef value_type&									reference;
+			typedef const value_type&							const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef gap_iterator<pointer, gap_vector>			iterator;
+			typedef gap_iterator<const_pointer, gap_vector>		const_iterator;
+			typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+			/* Default constructor */
+			gap_vector() : _alloc(allocator_type()), _start(NULL), _gap_begin(NULL), _gap_end(NULL), _cap(NULL) {};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	gap_vector(const allocator_type& alloc) : _alloc(alloc), _start(NULL), _gap_begin(NULL), _gap_end(NULL), _cap(NULL) {};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	gap_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _start(NULL), _gap_begin(NULL), _gap_end(NULL), _cap(NULL)
+			{
+				this->insert(this->end(), count, value);
+			};
+
+			/* Constructs the container with the contents of the range */
+			template <class InputIt>
+			gap_vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc), _start(NULL), _gap_begin(NULL), _gap_end(NULL), _cap(NULL)
+			{
+				this->insert(this->end(), first, last);
+			}
+
+			/* Copy constructor */
+			gap_vector(const gap_vector& other) : _alloc(other._alloc), _start(NULL), _gap_begin(NULL), _gap_end(NULL), _cap(NULL)
+			{
+				this->reserve(other.size());
+				this->insert(this->end(), other.begin(), other.end());
+			};
+
+			/* Deconstructor */
+			~gap_vector()
+			{
+				this->clear();
+				if (this->_start != NULL)
+					this->_alloc.deallocate(this->_start, this->capacity());
+			};
+
+			/* Copy assignation operator */
+			gap_vector&	operator=(const gap_vector& other)
+			{
+				if (this == &other)
+					return (*this);
+				gap_vector	temp(other);
+				this->swap(temp);
+				return (*this);
+			};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const value_type& value)
+			{
+				this->clear();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->clear();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				return (*this->physical(pos));
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (*this->physical(pos));
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				return (*this->begin());
+			};
+
+			const_reference	front() const
+			{
+				return (*this->begin());
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				return (*(this->end() - 1));
+			};
+
+			const_reference	back() const
+			{
+				return (*(this->end() - 1));
+			};
+
+			/* Element access: Closes the gap by moving it to the end, then returns pointer to the now contiguous elements */
+			pointer	data()
+			{
+				this->move_gap(this->size());
+				return (this->_start);
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				return (iterator(this->physical(0), this->_gap_begin, this->_gap_end));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->physical(0), this->_gap_begin, this->_gap_end));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				return (iterator(this->_cap, this->_gap_begin, this->_gap_end));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this->_cap, this->_gap_begin, this->_gap_end));
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (this->capacity() - this->gap_size());
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return (std::min(this->_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max())));
+			};
+
+			/* Capacity: Increase the capacity of the vector (Allocation might be needed) to a value that's greator or equal to new_cap */
+			void	reserve(size_type new_cap)
+			{
+				if (new_cap > this->max_size())
+					throw std::length_error("Length error");
+				if (new_cap > this->capacity())
+					this->reallocate(new_cap, this->gap_index());
+			};
+
+			/* Capacity: Returns the number of elements that the container has currently allocated space for */
+			size_type	capacity() const
+			{
+				return (static_cast<size_type>(this->_cap - this->_start));
+			};
+
+			/* Capacity: Returns the index of the gap, where an insert costs no element moves */
+			size_type	gap_index() const
+			{
+				return (static_cast<size_type>(this->_gap_begin - this->_start));
+			};
+
+			/* Capacity: Returns the number of free slots in the gap */
+			size_type	gap_size() const
+			{
+				return (static_cast<size_type>(this->_gap_end - this->_gap_begin));
+			};
+
+			/* Modifiers: Erases all elements from the container */
+			void	clear()
+			{
+				this->destroy(this->_start, this->_gap_begin);
+				this->destroy(this->_gap_end, this->_cap);
+				this->_gap_begin = this->_start;
+				this->_gap_end = this->_cap;
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const size_type	index = pos - this->begin();
+				this->insert(pos, 1, value);
+				return (this->begin() + index);
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				const size_type		index = pos - this->begin();
+				const value_type	copy = value;
+
+				if (count == 0)
+					return ;
+				this->open_gap(index, count);
+				for (; count > 0; count--, this->_gap_begin++)
+					this->_alloc.construct(this->_gap_begin, copy);
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				size_type	index = pos - this->begin();
+
+				for (; first != last; ++first, ++index)
+				{
+					const value_type	copy = *first;
+					this->open_gap(index, 1);
+					this->_alloc.construct(this->_gap_begin, copy);
+					this->_gap_begin++;
+				}
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				return (this->erase(pos, pos + 1));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) by growing the gap over them */
+			iterator	erase(iterator first, iterator last)
+			{
+				const size_type	begin = first - this->begin();
+				const size_type	end = last - this->begin();
+
+				if (begin == end)
+					return (first);
+				if (this->gap_index() > begin)
+				{
+					this->move_gap(end);
+					this->destroy(this->_start + begin, this->_gap_begin);
+					this->_gap_begin = this->_start + begin;
+				}
+				else
+				{
+					this->move_gap(begin);
+					this->destroy(this->_gap_end, this->_gap_end + (end - begin));
+					this->_gap_end += end - begin;
+				}
+				return (this->begin() + begin);
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				this->insert(this->end(), 1, value);
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->erase(this->end() - 1);
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				const size_type	len = this->size();
+				if (count > len)
+					this->insert(this->end(), count - len, value);
+				else if (count < len)
+					this->erase(this->begin() + count, this->end());
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(gap_vector& other)
+			{
+				std::swap(this->_start, other._start);
+				std::swap(this->_gap_begin, other._gap_begin);
+				std::swap(this->_gap_end, other._gap_end);
+				std::swap(this->_cap, other._cap);
+			};
+
+		private:
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: Returns the address of the element at index, skipping the gap */
+			pointer	physical(size_type index) const
+			{
+				pointer	pos = this->_start + index;
+				if (pos >= this->_gap_begin)
+					pos += this->_gap_end - this->_gap_begin;
+				return (pos);
+			};
+
+			/* Helper function: Destroys the elements in [first, last) */
+			void	destroy(pointer first, pointer last)
+			{
+				for (; first != last; first++)
+					this->_alloc.destroy(first);
+			};
+
+			/* Helper function: Moves the element at src into the free slot dst */
+			void	relocate(pointer dst, pointer src)
+			{
+				this->_alloc.construct(dst, *src);
+				this->_alloc.destroy(src);
+			};
+
+			/**
+			 * Helper function: Moves the gap so that it starts at index. Only the elements between the old and the new
+			 * position move. Elements that cannot be memmoved are relocated one by one with the gap following each of
+			 * them, so a throwing copy leaves every element on either side of the gap alive exactly once
+			 */
+			void	move_gap(size_type index)
+			{
+				pointer			target = this->_start + index;
+				const size_type	count = (target < this->_gap_begin) ? this->_gap_begin - target : target - this->_gap_begin;
+
+				if (target == this->_gap_begin)
+					return ;
+				if (this->_gap_begin == this->_gap_end)
+				{
+					this->_gap_begin = target;
+					this->_gap_end = target;
+					return ;
+				}
+				if (is_trivially_copyable<T>::value)
+				{
+					if (target < this->_gap_begin)
+					{
+						std::memmove(static_cast<void*>(this->_gap_end - count), static_cast<const void*>(target), count * sizeof(T));
+						this->_gap_begin -= count;
+						this->_gap_end -= count;
+					}
+					else
+					{
+						std::memmove(static_cast<void*>(this->_gap_begin), static_cast<const void*>(this->_gap_end), count * sizeof(T));
+						this->_gap_begin += count;
+						this->_gap_end += count;
+					}
+					return ;
+				}
+				for (; this->_gap_begin > target; this->_gap_begin--, this->_gap_end--)
+					this->relocate(this->_gap_end - 1, this->_gap_begin - 1);
+				for (; this->_gap_begin < target; this->_gap_begin++, this->_gap_end++)
+					this->relocate(this->_gap_begin, this->_gap_end);
+			};
+
+			/* Helper function: Moves the gap to index and makes sure it has room for count elements */
+			void	open_gap(size_type index, size_type count)
+			{
+				if (this->gap_size() >= count)
+					this->move_gap(index);
+				else
+					this->reallocate(this->get_expansion(count), index);
+			};
+
+			/* Helper function: Returns the capacity after count expansions */
+			size_type	get_expansion(size_type count) const
+			{
+				const size_type	max = this->max_size();
+				const size_type	cap = this->capacity();
+				if (max - this->size() < count)
+					throw std::length_error("Length error");
+				if (cap >= max / 2)
+					return (max);
+				return (std::max(this->size() + count, cap * 2));
+			};
+
+			/* Helper function: Copies the elements into a buffer of new_cap elements with the gap at index */
+			void	reallocate(size_type new_cap, size_type index)
+			{
+				const size_type	size = this->size();
+				pointer			start = this->_alloc.allocate(new_cap);
+				pointer			gap_end = start + new_cap - (size - index);
+				size_type		i = 0;
+
+				try
+				{
+					for (; i < size; i++)
+						this->_alloc.construct((i < index) ? start + i : gap_end + (i - index), *this->physical(i));
+				}
+				catch (...)
+				{
+					while (i-- > 0)
+						this->_alloc.destroy((i < index) ? start + i : gap_end + (i - index));
+					this->_alloc.deallocate(start, new_cap);
+					throw ;
+				}
+				this->clear();
+				if (this->_start != NULL)
+					this->_alloc.deallocate(this->_start, this->capacity());
+				this->_start = start;
+				this->_gap_begin = start + index;
+				this->_gap_end = gap_end;
+				this->_cap = start + new_cap;
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			pointer			_start;
+			pointer			_gap_begin;
+			pointer			_gap_end;
+			pointer			_cap;
+	};
+
+	/* Lexicographically compares the values in the vector */
+	template <class T, class Alloc>
+	bool	operator==(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator<(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const gap_vector<T, Alloc>& lhs, const gap_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, class Alloc>
+	void	swap(gap_vector<T, Alloc>& lhs, gap_vector<T, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap_algorithm.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:36 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:36 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HEAP_ALGORITHM_HPP
+# define HEAP_ALGORITHM_HPP
+
+# include <cstddef>
+# include "iterator.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/algorithm/push_heap
+ * https://en.wikipedia.org/wiki/D-ary_heap
+ *
+ * Heap operations on a random access range laid out as an implicit D-ary tree:
+ *
+ *                          0
+ *              /      /         \      \
+ *             1      2           3      4          (D = 4)
+ *           / | \ \
+ *          5  6  7  8  ...
+ *
+ * 	1. The children of index i are D * i + 1 ... D * i + D
+ * 	2. The parent of index i is (i - 1) / D
+ * 	3. No element compares less than any of its children (max-heap with std::less)
+ *
+ * With D = 4 the heap is half as tall as a binary heap and the children of a
+ * node sit next to each other, usually on one cache line, so a sift-down takes
+ * fewer cache misses at the price of more comparisons per level. Sifting moves
+ * a hole instead of swapping, so each displaced element is written once
+ */
+namespace ft
+{
+	/* Moves value up from hole until its parent no longer compares less than it */
+	template <std::size_t D, class RandomIt, class Distance, class T, class Compare>
+	void	heap_sift_up(RandomIt first, Distance hole, const T& value, Compare comp)
+	{
+		Distance	parent;
+
+		while (hole > 0 && comp(*(first + (parent = (hole - 1) / D)), value))
+		{
+			*(first + hole) = *(first + parent);
+			hole = parent;
+		}
+		*(first + hole) = value;
+	}
+
+	/* Moves value down from hole, among the first len elements, until none of its children compares greater */
+	template <std::size_t D, class RandomIt, class Distance, class T, class Compare>
+	void	heap_sift_down(RandomIt first, Distance hole, Distance len, const T& value, Compare comp)
+	{
+		Distance	child;
+
+		while ((child = hole * D + 1) < len)
+		{
+			const Distance	last = (len - child > Distance(D)) ? child + D : len;
+			Distance		best = child;
+
+			for (++child; child < last; ++child)
+				if (comp(*(first + best), *(first + child)))
+					best = child;
+			if (comp(value, *(first + best)) == false)
+				break ;
+			*(first + hole) = *(first + best);
+			hole = best;
+		}
+		*(first + hole) = value;
+	}
+
+	/* Inserts the element at last - 1 into the heap [first, last - 1) */
+	template <std::size_t D, class RandomIt, class Compare>
+	void	push_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIt>::value_type		value_type;
+		typedef typename iterator_traits<RandomIt>::difference_type	difference_type;
+
+		const difference_type	len = last - first;
+		if (len < 2)
+			return ;
+		const value_type	value = *(last - 1);
+		heap_sift_up<D>(first, len - 1, value, comp);
+	}
+
+	/* Swaps the top of the heap [first, last) into last - 1 and restores the heap [first, last - 1) */
+	template <std::size_t D, class RandomIt, class Compare>
+	void	pop_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIt>::value_type		value_type;
+		typedef typename iterator_traits<RandomIt>::difference_type	difference_type;
+
+		const difference_type	len = last - first;
+		if (len < 2)
+			return ;
+		const value_type	value = *(last - 1);
+		*(last - 1) = *first;
+		heap_sift_down<D>(first, difference_type(0), len - 1, value, comp);
+	}
+
+	/* Turns [first, last) into a heap in O(n) by sifting down every inner node, deepest first */
+	template <std::size_t D, class RandomIt, class Compare>
+	void	make_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIt>::value_type		value_type;
+		typedef typename iterator_traits<RandomIt>::difference_type	difference_type;
+
+		const difference_type	len = last - first;
+		if (len < 2)
+			return ;
+		for (difference_type i = (len - 2) / D + 1; i > 0; --i)
+		{
+			const value_type	value = *(first + (i - 1));
+			heap_sift_down<D>(first, i - 1, len, value, comp);
+		}
+	}
+
+	/* Checks whether [first, last) is a heap */
+	template <std::size_t D, class RandomIt, class Compare>
+	bool	is_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIt>::difference_type	difference_type;
+
+		const difference_type	len = last - first;
+		for (difference_type i = 1; i < len; ++i)
+			if (comp(*(first + (i - 1) / D), *(first + i)))
+				return (false);
+		return (true);
+	}
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/25 12:22:27 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/20 15:06:27 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 11:07:52 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -101,9 +101,11 @@ namespace ft
 				return (*(--tmp));
 			};
 
+			/* Forwards to operator-> of the underlying iterator, so proxy iterators whose reference is a temporary work too */
 			pointer	operator->() const
 			{
-				return (&(this->operator*()));
+				Iter tmp = current;
+				return (arrow(--tmp));
 			};
 		
 			/* Accesses an element by index */
@@ -161,6 +163,20 @@ namespace ft
 		protected:
 			/* Protected member variables */
 			Iter	current;
+
+		private:
+			/* Helper function: Returns what it->operator-> returns, or it itself for a plain pointer */
+			template <class P>
+			static P*	arrow(P* it)
+			{
+				return (it);
+			}
+
+			template <class I>
+			static typename I::pointer	arrow(const I& it)
+			{
+				return (it.operator->());
+			}
 	};
 
 	/* Compares the underlying iterators */
@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/15 12:37:49 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/23 13:56:38 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 13:14:37 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,81 +16,16 @@
 # include <functional>
 # include "iterator.hpp"
 # include "rbtree.hpp"
+# include "vt_compare.hpp"
+# include "frozen_map.hpp"
 
 /**
  * https://en.cppreference.com/w/cpp/container/map
- * https://en.cppreference.com/w/cpp/utility/functional/binary_function
  */
 namespace ft
 {
-	/* Value type comparison class */
-	template <class Key, class T, class Compare>
-	class vt_compare : public std::binary_function<Key, Key, bool>
+	namespace FT_RBTREE_NAMESPACE
 	{
-		public:
-			/* Public member variables */
-			bool	result_type;
-			Key		first_argument_type;
-			Key		second_argument_type;
-
-			/* Default constructor */
-			vt_compare() {};
-
-			/* Copy constructor */
-			vt_compare(const Compare& c) : _comp(c) {};
-
-			/* Destructor */
-			~vt_compare() {};
-
-			/* Copy assignation operator */
-			vt_compare	&operator=(const vt_compare& other)
-			{
-				if (this == &other)
-					return (*this);
-				this->_comp = other._comp;
-				return (*this);
-			};
-
-			/* Function object */
-			const	Compare& key_comp() const
-			{
-				return (this->_comp);
-			};
-
-			/* Comparisons using key_comp */
-			bool	operator()(const T& x, const T& y) const
-			{
-				return (key_comp()(x.first, y.first));
-			};
-
-			bool	operator()(const Key& x, const T& y) const
-			{
-				return (key_comp()(x, y.first));
-			};
-			
-			bool	operator()(const T& x, const Key& y) const
-			{
-				return (key_comp()(x.first, y));
-			};
-
-			/* Swaps the value of _comp */
-			void	swap(vt_compare& other)
-			{
-				std::swap(this->_comp, other._comp);
-			};
-
-		private:
-			/* Private member variables */
-			Compare	_comp;
-	};
-
-	/* Swaps the x and y */
-	template <class Key, class T, class Compare>
-	void	swap(vt_compare<Key, T, Compare>& x, vt_compare<Key, T, Compare>& y)
-	{
-		x.swap(y);
-	}
-	
 	/* Map class */
 	template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, T> > >
 	class map
@@ -120,6 +55,8 @@ namespace ft
 			typedef typename base::const_iterator					const_iterator;
 			typedef ft::reverse_iterator<iterator>					reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef map_node_handle<Key, T, Allocator>				node_type;
+			typedef node_insert_return<iterator, node_type>			insert_return_type;
 
 			/* Value_compare subclass */
 			class value_compare : public std::binary_function<value_type, value_type, bool>
@@ -160,6 +97,13 @@ namespace ft
 				insert(first, last);
 			};
 
+			/* Constructs the container from the range [first, last), which must be sorted by comp and hold no equivalent keys. Takes O(n) */
+			template <class ForwardIt>
+			map(sorted_unique_t, ForwardIt first, ForwardIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _rbtree(vt_compare(comp), alloc)
+			{
+				this->_rbtree.assign_sorted(first, last);
+			}
+
 			/* Copy constructor */
 			map(const map& other) : _rbtree(other._rbtree) {};
 
@@ -284,6 +228,24 @@ namespace ft
 				return (this->_rbtree.insert(pos, value));
 			}
 
+			/* Modifiers: Inserts the node owned by nh. If an element with an equivalent key is already there, the node is handed back in the result */
+			insert_return_type	insert(node_type nh)
+			{
+				insert_return_type		result;
+				pair<iterator, bool>	inserted = this->_rbtree.insert(nh);
+
+				result.position = inserted.first;
+				result.inserted = inserted.second;
+				result.node = nh;
+				return (result);
+			}
+
+			/* Modifiers: Inserts the node owned by nh in the position as close as possible to the position just prior to pos. If an element with an equivalent key is already there, nh keeps the node. nh may be a temporary, such as the result of extract() */
+			iterator	insert(iterator pos, const node_type& nh)
+			{
+				return (this->_rbtree.insert(pos, nh));
+			}
+
 			/* Modifiers: Inserts elements from range [first, last) */
 			template <class InputIt>
 			void	insert(InputIt first, InputIt last)
@@ -309,12 +271,47 @@ namespace ft
 				return (this->_rbtree.erase(key));
 			}
 
+			/* Modifiers: Removes every element for which pred returns true in one in-order pass and returns how many were removed. Once more than rebuild_fraction of the elements seen were removed, the rest of the tree is rebuilt in O(n) */
+			template <class Predicate>
+			size_type	erase_if(Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+			{
+				return (this->_rbtree.erase_if(pred, rebuild_fraction));
+			}
+
+			/* Modifiers: Unlinks the element at pos and returns a node handle owning it, without copying it */
+			node_type	extract(iterator pos)
+			{
+				return (node_type(this->_rbtree.extract(const_iterator(pos))));
+			}
+
+			/* Modifiers: Unlinks the element with the key, if there is one, and returns a node handle owning it */
+			node_type	extract(const key_type& key)
+			{
+				iterator	it = this->find(key);
+
+				if (it == this->end())
+					return (node_type());
+				return (this->extract(it));
+			}
+
+			/* Modifiers: Moves the elements of source whose key is not in *this into *this, relinking their nodes without copying them when the allocators are equal */
+			void	merge(map& source)
+			{
+				this->_rbtree.merge(source._rbtree);
+			}
+
 			/* Modifiers: Swaps the contents */
 			void	swap(map& other)
 			{
 				this->_rbtree.swap(other._rbtree);
 			}
 
+			/* Modifiers: Rebuilds the tree into one block of nodes in key order with minimal height. Invalidates all iterators, pointers and references */
+			void	compact()
+			{
+				this->_rbtree.compact();
+			}
+
 			/* Lookup: Returns the number of elements matching specific key */
 			size_type	count(const key_type& key) const
 			{
@@ -332,6 +329,19 @@ namespace ft
 				return (this->_rbtree.find(key));
 			}
 
+			/* Lookup: Finds every key in [keys_first, keys_last) and writes an iterator to each, or end(), to out. Faster than calling find() in a loop on large trees */
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt keys_first, ForwardIt keys_last, OutputIt out)
+			{
+				return (this->_rbtree.find_batch(keys_first, keys_last, out));
+			}
+
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) const
+			{
+				return (this->_rbtree.find_batch(keys_first, keys_last, out));
+			}
+
 			/* Lookup: Returns range of elements matching a specific key */
 			pair<iterator, iterator>	equal_range(const key_type& key)
 			{
@@ -377,6 +387,12 @@ namespace ft
 				return (value_compare(this->_rbtree.value_comp().key_comp()));
 			}
 
+			/* Returns a read-only copy laid out for fast lookups, once the map will no longer change */
+			frozen_map<Key, T, Compare, Allocator>	freeze() const
+			{
+				return (frozen_map<Key, T, Compare, Allocator>(this->begin(), this->end(), this->key_comp(), this->get_allocator()));
+			}
+
 		private:
 			/* Private member variables */
 			base	_rbtree;
@@ -419,12 +435,22 @@ namespace ft
 		return (!(lhs < rhs));
 	}
 
+	/* Removes every element for which pred returns true and returns how many were removed */
+	template <class Key, class T, class Compare, class Alloc, class Predicate>
+	typename map<Key, T, Compare, Alloc>::size_type	erase_if(map<Key, T, Compare, Alloc>& c, Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+	{
+		return (c.erase_if(pred, rebuild_fraction));
+	}
+
 	/* Swaps the contents of lhs and rhs */
 	template <class Key, class T, class Compare, class Alloc>
 	void	swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs)
 	{
 		lhs.swap(rhs);
 	}
+	}
+	using FT_RBTREE_NAMESPACE::swap;
+	using FT_RBTREE_NAMESPACE::erase_if;
 }
 
 #endif
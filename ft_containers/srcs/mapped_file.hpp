@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_file.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:14:29 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 20:14:29 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPPED_FILE_HPP
+# define MAPPED_FILE_HPP
+
+# include <cstddef>
+# include <cerrno>
+# include <cstring>
+# include <string>
+# include <stdexcept>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+
+/**
+ * https://man7.org/linux/man-pages/man2/mmap.2.html
+ * https://man7.org/linux/man-pages/man2/ftruncate.2.html
+ * https://man7.org/linux/man-pages/man2/msync.2.html
+ *
+ * A file mapped into memory with MAP_SHARED, used by the containers that keep
+ * their storage in a file. Pages are read from disk lazily on first access
+ * and writes reach the file through the page cache. Resizing the file maps it
+ * again, so every pointer into the old mapping is invalidated. Failures of
+ * the system calls throw std::runtime_error
+ */
+namespace ft
+{
+	/* Mapped_file class */
+	class mapped_file
+	{
+		public:
+			/* Opens path and maps all of it. A writable file is created when missing */
+			mapped_file(const char *path, bool writable) : _fd(-1), _data(NULL), _size(0), _writable(writable)
+			{
+				struct stat	info;
+
+				this->_fd = open(path, writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+				if (this->_fd == -1)
+					fail(path);
+				if (fstat(this->_fd, &info) == -1)
+				{
+					close(this->_fd);
+					fail(path);
+				}
+				this->_size = static_cast<std::size_t>(info.st_size);
+				try
+				{
+					this->map();
+				}
+				catch (...)
+				{
+					close(this->_fd);
+					throw ;
+				}
+			};
+
+			/* Unmaps and closes the file. Pending writes still reach the file through the page cache */
+			~mapped_file()
+			{
+				this->unmap();
+				close(this->_fd);
+			};
+
+			/* Returns the start of the mapping, or NULL while the file is empty */
+			char	*data() const
+			{
+				return (this->_data);
+			};
+
+			/* Returns the size of the file in bytes */
+			std::size_t	size() const
+			{
+				return (this->_size);
+			};
+
+			/* Returns whether the file was opened for writing */
+			bool	writable() const
+			{
+				return (this->_writable);
+			};
+
+			/* Sets the size of the file to bytes and maps it again */
+			void	resize(std::size_t bytes)
+			{
+				if (this->_writable == false)
+					throw std::runtime_error("mapped_file: read-only file");
+				this->unmap();
+				if (ftruncate(this->_fd, static_cast<off_t>(bytes)) == -1)
+				{
+					this->map();
+					fail("ftruncate");
+				}
+				this->_size = bytes;
+				this->map();
+			};
+
+			/* Writes the dirty pages of the mapping back to the file and waits for the write to finish */
+			void	sync()
+			{
+				if (this->_data != NULL && this->_writable && msync(this->_data, this->_size, MS_SYNC) == -1)
+					fail("msync");
+			};
+
+		private:
+			/* Not copyable: the mapping is owned by one object */
+			mapped_file(const mapped_file&);
+			mapped_file&	operator=(const mapped_file&);
+
+			/* Helper function: Throws std::runtime_error describing errno */
+			static void	fail(const std::string& what)
+			{
+				throw std::runtime_error("mapped_file: " + what + ": " + std::strerror(errno));
+			};
+
+			/* Helper function: Maps the whole file */
+			void	map()
+			{
+				void	*addr;
+
+				if (this->_size == 0)
+					return ;
+				addr = mmap(NULL, this->_size, this->_writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, this->_fd, 0);
+				if (addr == MAP_FAILED)
+					fail("mmap");
+				this->_data = static_cast<char *>(addr);
+			};
+
+			/* Helper function: Removes the mapping */
+			void	unmap()
+			{
+				if (this->_data != NULL)
+					munmap(this->_data, this->_size);
+				this->_data = NULL;
+			};
+
+			/* Private member variables */
+			int			_fd;
+			char		*_data;
+			std::size_t	_size;
+			bool		_writable;
+	};
+}
+
+#endif
@@ -0,0 +1,298 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_frozen_map.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:38:54 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 22:38:54 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPPED_FROZEN_MAP_HPP
+# define MAPPED_FROZEN_MAP_HPP
+
+# include <iterator>
+# include <stdexcept>
+# include <functional>
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "type_traits.hpp"
+# include "frozen_file.hpp"
+
+/**
+ * Read-only map queried in place in a frozen file (see frozen_file.hpp).
+ * Opening it maps the file and reads the header, nothing is deserialised,
+ * and processes that open the same file share its pages. write() stores the
+ * contents of a sorted map, and ft::map(ft::sorted_unique, begin(), end())
+ * loads a file back in O(n).
+ *
+ * Keys and values are stored as raw bytes, so both must be trivially
+ * copyable. The comparator is not stored and must order keys the same way
+ * as when the file was written
+ */
+namespace ft
+{
+	/* Random access iterator over a mapped_frozen_map. Dereferencing returns the pair by value */
+	template <class Key, class T>
+	class mapped_frozen_map_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::random_access_iterator_tag	iterator_category;
+			typedef pair<const Key, T>				value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef value_type						reference;
+			typedef const value_type*				pointer;
+
+			/* Orthodox canonical form */
+			mapped_frozen_map_iterator() : _keys(NULL), _values(NULL), _pos(0) {};
+			mapped_frozen_map_iterator(const mapped_frozen_map_iterator& other) : _keys(other._keys), _values(other._values), _pos(other._pos) {};
+			~mapped_frozen_map_iterator() {};
+			mapped_frozen_map_iterator&	operator=(const mapped_frozen_map_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_keys = other._keys;
+				this->_values = other._values;
+				this->_pos = other._pos;
+				return (*this);
+			};
+
+			/* Constructor with the key and value arrays and a position */
+			mapped_frozen_map_iterator(const Key *keys, const T *values, difference_type pos) : _keys(keys), _values(values), _pos(pos) {};
+
+			/* Returns the key and value in the mapping */
+			const Key&	key() const
+			{
+				return (this->_keys[this->_pos]);
+			};
+
+			const T&	value() const
+			{
+				return (this->_values[this->_pos]);
+			};
+
+			/* Returns a copy of the element */
+			reference	operator*() const
+			{
+				return (value_type(this->key(), this->value()));
+			};
+
+			reference	operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			};
+
+			/* Moves the iterator */
+			mapped_frozen_map_iterator&	operator++()
+			{
+				++this->_pos;
+				return (*this);
+			};
+
+			mapped_frozen_map_iterator	operator++(int)
+			{
+				mapped_frozen_map_iterator	it = *this;
+				++this->_pos;
+				return (it);
+			};
+
+			mapped_frozen_map_iterator&	operator--()
+			{
+				--this->_pos;
+				return (*this);
+			};
+
+			mapped_frozen_map_iterator	operator--(int)
+			{
+				mapped_frozen_map_iterator	it = *this;
+				--this->_pos;
+				return (it);
+			};
+
+			mapped_frozen_map_iterator&	operator+=(difference_type n)
+			{
+				this->_pos += n;
+				return (*this);
+			};
+
+			mapped_frozen_map_iterator&	operator-=(difference_type n)
+			{
+				this->_pos -= n;
+				return (*this);
+			};
+
+			mapped_frozen_map_iterator	operator+(difference_type n) const
+			{
+				return (mapped_frozen_map_iterator(this->_keys, this->_values, this->_pos + n));
+			};
+
+			mapped_frozen_map_iterator	operator-(difference_type n) const
+			{
+				return (mapped_frozen_map_iterator(this->_keys, this->_values, this->_pos - n));
+			};
+
+			/* Returns the distance between two iterators */
+			difference_type	operator-(const mapped_frozen_map_iterator& other) const
+			{
+				return (this->_pos - other._pos);
+			};
+
+			/* Compares the positions */
+			bool	operator==(const mapped_frozen_map_iterator& other) const { return (this->_pos == other._pos); };
+			bool	operator!=(const mapped_frozen_map_iterator& other) const { return (this->_pos != other._pos); };
+			bool	operator<(const mapped_frozen_map_iterator& other) const { return (this->_pos < other._pos); };
+			bool	operator<=(const mapped_frozen_map_iterator& other) const { return (this->_pos <= other._pos); };
+			bool	operator>(const mapped_frozen_map_iterator& other) const { return (this->_pos > other._pos); };
+			bool	operator>=(const mapped_frozen_map_iterator& other) const { return (this->_pos >= other._pos); };
+
+		private:
+			/* Private member variables */
+			const Key		*_keys;
+			const T			*_values;
+			difference_type	_pos;
+	};
+
+	/* Mapped_frozen_map class */
+	template <class Key, class T, class Compare = std::less<Key> >
+	class mapped_frozen_map
+	{
+		private:
+			/* Keys and values are written to the file as raw bytes */
+			typedef char	keys_must_be_trivially_copyable[is_trivially_copyable<Key>::value ? 1 : -1];
+			typedef char	values_must_be_trivially_copyable[is_trivially_copyable<T>::value ? 1 : -1];
+
+		public:
+			/* Member types */
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef pair<const Key, T>						value_type;
+			typedef std::size_t								size_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef Compare									key_compare;
+			typedef mapped_frozen_map_iterator<Key, T>		iterator;
+			typedef mapped_frozen_map_iterator<Key, T>		const_iterator;
+
+			/* Writes the range [first, last) of pairs, sorted by comp and free of equivalent keys, to path */
+			template <class ForwardIt>
+			static void	write(const char *path, ForwardIt first, ForwardIt last)
+			{
+				frozen_file_writer	writer(path, sizeof(Key), sizeof(T), static_cast<size_type>(std::distance(first, last)));
+
+				for (; first != last; ++first)
+				{
+					const value_type	value = *first;
+					writer.append(&value.first, &value.second);
+				}
+				writer.finish();
+			}
+
+			/* Maps the frozen file at path */
+			explicit	mapped_frozen_map(const char *path, const key_compare& comp = key_compare()) : _file(path, sizeof(Key), sizeof(T)), _comp(comp) {};
+
+			/* Destructor */
+			~mapped_frozen_map() {};
+
+			/* Reads the whole file and returns whether its checksums match */
+			bool	verify() const
+			{
+				return (this->_file.verify());
+			};
+
+			/* Element access: Returns a reference into the mapping to the value mapped to key, with bounds checking */
+			const T&	at(const Key& key) const
+			{
+				const_iterator	it = this->find(key);
+				if (it == this->end())
+					throw std::out_of_range("Out of range");
+				return (it.value());
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			const_iterator	begin() const
+			{
+				return (this->iterator_at(0));
+			};
+
+			/* Iterators: Returns an iterator to the end */
+			const_iterator	end() const
+			{
+				return (this->iterator_at(this->size()));
+			};
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_file.header().size);
+			};
+
+			/* Lookup: Returns the number of elements matching specific key */
+			size_type	count(const Key& key) const
+			{
+				return (this->find(key) == this->end() ? 0 : 1);
+			};
+
+			/* Lookup: Finds element with specific key */
+			const_iterator	find(const Key& key) const
+			{
+				const_iterator	it = this->lower_bound(key);
+
+				if (it == this->end() || this->_comp(key, it.key()))
+					return (this->end());
+				return (it);
+			};
+
+			/* Lookup: Returns range of elements matching a specific key */
+			pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				const_iterator	first = this->lower_bound(key);
+
+				if (first == this->end() || this->_comp(key, first.key()))
+					return (ft::make_pair(first, first));
+				return (ft::make_pair(first, first + 1));
+			};
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			const_iterator	lower_bound(const Key& key) const
+			{
+				return (this->iterator_at(this->_file.lower_bound(key, this->_comp)));
+			};
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			const_iterator	upper_bound(const Key& key) const
+			{
+				return (this->iterator_at(this->_file.upper_bound(key, this->_comp)));
+			};
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_comp);
+			};
+
+		private:
+			/* Not copyable: the mapping is owned by one object */
+			mapped_frozen_map(const mapped_frozen_map&);
+			mapped_frozen_map&	operator=(const mapped_frozen_map&);
+
+			/* Helper function: Returns an iterator to position pos */
+			const_iterator	iterator_at(size_type pos) const
+			{
+				return (const_iterator(reinterpret_cast<const Key *>(this->_file.keys()), reinterpret_cast<const T *>(this->_file.values()), static_cast<difference_type>(pos)));
+			};
+
+			/* Private member variables */
+			frozen_file	_file;
+			key_compare	_comp;
+	};
+}
+
+#endif
@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_frozen_set.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:38:54 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 22:38:54 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPPED_FROZEN_SET_HPP
+# define MAPPED_FROZEN_SET_HPP
+
+# include <iterator>
+# include <functional>
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "type_traits.hpp"
+# include "frozen_file.hpp"
+
+/**
+ * Read-only set queried in place in a frozen file (see frozen_file.hpp).
+ * The keys are one sorted array in the mapping, so the iterators are plain
+ * pointers into it. write() stores the contents of a sorted set, and
+ * ft::set(ft::sorted_unique, begin(), end()) loads a file back in O(n).
+ *
+ * Keys are stored as raw bytes, so they must be trivially copyable. The
+ * comparator is not stored and must order keys the same way as when the file
+ * was written
+ */
+namespace ft
+{
+	/* Mapped_frozen_set class */
+	template <class Key, class Compare = std::less<Key> >
+	class mapped_frozen_set
+	{
+		private:
+			/* Keys are written to the file as raw bytes */
+			typedef char	keys_must_be_trivially_copyable[is_trivially_copyable<Key>::value ? 1 : -1];
+
+		public:
+			/* Member types */
+			typedef Key										key_type;
+			typedef Key										value_type;
+			typedef std::size_t								size_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef Compare									key_compare;
+			typedef Compare									value_compare;
+			typedef const value_type&						const_reference;
+			typedef const value_type*						const_pointer;
+			typedef const value_type*						iterator;
+			typedef const value_type*						const_iterator;
+			typedef ft::reverse_iterator<const_iterator>	reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+			/* Writes the range [first, last) of keys, sorted by comp and free of equivalent keys, to path */
+			template <class ForwardIt>
+			static void	write(const char *path, ForwardIt first, ForwardIt last)
+			{
+				frozen_file_writer	writer(path, sizeof(Key), 0, static_cast<size_type>(std::distance(first, last)));
+
+				for (; first != last; ++first)
+				{
+					const value_type	value = *first;
+					writer.append(&value, NULL);
+				}
+				writer.finish();
+			}
+
+			/* Maps the frozen file at path */
+			explicit	mapped_frozen_set(const char *path, const key_compare& comp = key_compare()) : _file(path, sizeof(Key), 0), _comp(comp) {};
+
+			/* Destructor */
+			~mapped_frozen_set() {};
+
+			/* Reads the whole file and returns whether its checksums match */
+			bool	verify() const
+			{
+				return (this->_file.verify());
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			const_iterator	begin() const
+			{
+				return (reinterpret_cast<const_iterator>(this->_file.keys()));
+			};
+
+			/* Iterators: Returns an iterator to the end */
+			const_iterator	end() const
+			{
+				return (this->begin() + this->size());
+			};
+
+			/* Iterators: Returns a reverse iterator to the beginning */
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the end */
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_file.header().size);
+			};
+
+			/* Lookup: Returns the number of elements matching specific key */
+			size_type	count(const Key& key) const
+			{
+				return (this->find(key) == this->end() ? 0 : 1);
+			};
+
+			/* Lookup: Finds element with specific key */
+			const_iterator	find(const Key& key) const
+			{
+				const_iterator	it = this->lower_bound(key);
+
+				if (it == this->end() || this->_comp(key, *it))
+					return (this->end());
+				return (it);
+			};
+
+			/* Lookup: Returns range of elements matching a specific key */
+			pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				const_iterator	first = this->lower_bound(key);
+
+				if (first == this->end() || this->_comp(key, *first))
+					return (ft::make_pair(first, first));
+				return (ft::make_pair(first, first + 1));
+			};
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			const_iterator	lower_bound(const Key& key) const
+			{
+				return (this->begin() + this->_file.lower_bound(key, this->_comp));
+			};
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			const_iterator	upper_bound(const Key& key) const
+			{
+				return (this->begin() + this->_file.upper_bound(key, this->_comp));
+			};
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_comp);
+			};
+
+			/* Observers: Returns the function that compares keys in objects of type value_type */
+			value_compare	value_comp() const
+			{
+				return (this->_comp);
+			};
+
+		private:
+			/* Not copyable: the mapping is owned by one object */
+			mapped_frozen_set(const mapped_frozen_set&);
+			mapped_frozen_set&	operator=(const mapped_frozen_set&);
+
+			/* Private member variables */
+			frozen_file	_file;
+			key_compare	_comp;
+	};
+}
+
+#endif
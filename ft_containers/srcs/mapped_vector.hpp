@@ -0,0 +1,454 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:14:29 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:38:14 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPPED_VECTOR_HPP
+# define MAPPED_VECTOR_HPP
+
+# include <limits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "vector_iterator.hpp"
+# include "algorithm.hpp"
+# include "mapped_file.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/vector
+ * https://man7.org/linux/man-pages/man2/mmap.2.html
+ *
+ * Vector of trivially copyable records stored in a memory-mapped file. The
+ * file starts with a small header holding the size and capacity, followed by
+ * the elements. Reopening the file maps it without reading or copying
+ * anything, and pages are faulted in on first access. Growing extends the
+ * file with ftruncate and maps it again, which invalidates iterators like a
+ * reallocation of ft::vector does. sync() flushes the changes to disk; the
+ * page cache writes them back on its own otherwise.
+ *
+ * A file opened read-only is mapped with PROT_READ, so writing to it would
+ * crash. The non-const accessors and iterators throw like the modifiers do:
+ * read such a vector through a const reference
+ */
+namespace ft
+{
+	/* Mapped_vector class */
+	template <typename T>
+	class mapped_vector
+	{
+		private:
+			/* Elements are written to the file as raw bytes */
+			typedef char	elements_must_be_trivially_copyable[is_trivially_copyable<T>::value ? 1 : -1];
+
+		public:
+			/* Member types */
+			typedef T												value_type;
+			typedef std::size_t										size_type;
+			typedef std::ptrdiff_t									difference_type;
+			typedef value_type&										reference;
+			typedef const value_type&								const_reference;
+			typedef value_type*										pointer;
+			typedef const value_type*								const_pointer;
+			typedef vector_iterator<pointer, mapped_vector>			iterator;
+			typedef vector_iterator<const_pointer, mapped_vector>	const_iterator;
+			typedef	ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+			/* Opens the vector stored in path, creating an empty one when a writable file is missing */
+			explicit	mapped_vector(const char *path, bool writable = true) : _file(path, writable)
+			{
+				if (this->_file.size() == 0 && writable)
+				{
+					this->_file.resize(data_offset);
+					std::memcpy(this->header()->magic, file_magic, sizeof(file_magic));
+					this->header()->element_size = sizeof(value_type);
+					this->header()->size = 0;
+					this->header()->capacity = 0;
+				}
+				if (this->_file.size() < data_offset
+					|| std::memcmp(this->header()->magic, file_magic, sizeof(file_magic)) != 0
+					|| this->header()->element_size != sizeof(value_type)
+					|| this->header()->size > this->header()->capacity
+					|| this->header()->capacity > (this->_file.size() - data_offset) / sizeof(value_type))
+					throw std::runtime_error("mapped_vector: invalid file");
+			};
+
+			/* Deconstructor. Unmaps the file without forcing the changes to disk */
+			~mapped_vector() {};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const T& value)
+			{
+				this->clear();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->clear();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Writes every change to the file and waits until it is on disk */
+			void	sync()
+			{
+				this->_file.sync();
+			};
+
+			/* Returns whether the file was opened for writing */
+			bool	writable() const
+			{
+				return (this->_file.writable());
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_writable();
+				this->check_range(pos);
+				return (this->first()[pos]);
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return (this->first()[pos]);
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				this->check_writable();
+				return (this->first()[pos]);
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (this->first()[pos]);
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				this->check_writable();
+				return (this->first()[0]);
+			};
+
+			const_reference	front() const
+			{
+				return (this->first()[0]);
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				this->check_writable();
+				return (this->first()[this->size() - 1]);
+			};
+
+			const_reference	back() const
+			{
+				return (this->first()[this->size() - 1]);
+			};
+
+			/* Element access: Returns pointer to the underlying array serving as element storage */
+			pointer	data()
+			{
+				this->check_writable();
+				return (this->first());
+			};
+
+			const_pointer	data() const
+			{
+				return (this->first());
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				this->check_writable();
+				return (iterator(this->first()));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->first()));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				this->check_writable();
+				return (iterator(this->first() + this->size()));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this->first() + this->size()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (this->header()->size);
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return ((static_cast<size_type>(std::numeric_limits<off_t>::max()) - data_offset) / sizeof(value_type));
+			};
+
+			/* Capacity: Grows the file to hold at least new_cap elements */
+			void	reserve(size_type new_cap)
+			{
+				if (new_cap > this->max_size())
+					throw std::length_error("Length error");
+				if (new_cap <= this->capacity())
+					return ;
+				this->_file.resize(data_offset + new_cap * sizeof(value_type));
+				this->header()->capacity = new_cap;
+			};
+
+			/* Capacity: Returns the number of elements that the file currently has space for */
+			size_type	capacity() const
+			{
+				return (this->header()->capacity);
+			};
+
+			/* Capacity: Shrinks the file to the current size */
+			void	shrink_to_fit()
+			{
+				if (this->capacity() == this->size())
+					return ;
+				this->_file.resize(data_offset + this->size() * sizeof(value_type));
+				this->header()->capacity = this->size();
+			};
+
+			/* Modifiers: Erases all elements from the container */
+			void	clear()
+			{
+				this->set_size(0);
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const value_type	copy = value;
+				const size_type		index = this->open_gap(pos, 1);
+				this->first()[index] = copy;
+				return (this->begin() + index);
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				const value_type	copy = value;
+				const size_type		index = this->open_gap(pos, count);
+				std::fill_n(this->first() + index, count, copy);
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos. The range must not point into this vector */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->range_insert(pos, first, last, typename iterator_traits<InputIt>::iterator_category());
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				return (this->erase(pos, pos + 1));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			iterator	erase(iterator first, iterator last)
+			{
+				this->check_writable();
+				std::copy(last, this->end(), first);
+				this->set_size(this->size() - (last - first));
+				return (first);
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				const value_type	copy = value;
+				this->check_writable();
+				if (this->size() == this->capacity())
+					this->reserve(this->get_expansion(1));
+				this->first()[this->size()] = copy;
+				this->set_size(this->size() + 1);
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->set_size(this->size() - 1);
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				if (count > this->size())
+					this->insert(this->end(), count - this->size(), value);
+				else
+					this->set_size(count);
+			};
+
+		private:
+			/* Layout of the start of the file */
+			struct	file_header
+			{
+				char		magic[8];
+				size_type	element_size;
+				size_type	size;
+				size_type	capacity;
+			};
+
+			/* The elements start on their own cache line after the header */
+			static const size_type	data_offset = 64;
+			static const char		file_magic[8];
+
+			/* Not copyable: two objects would map the same file */
+			mapped_vector(const mapped_vector&);
+			mapped_vector&	operator=(const mapped_vector&);
+
+			/* Helper function: Returns the header at the start of the mapping */
+			file_header	*header() const
+			{
+				return (reinterpret_cast<file_header *>(this->_file.data()));
+			};
+
+			/* Helper function: Returns the first element slot */
+			pointer	first() const
+			{
+				return (reinterpret_cast<pointer>(this->_file.data() + data_offset));
+			};
+
+			/* Helper function: Throws std::runtime_error before a write to a read-only file */
+			void	check_writable() const
+			{
+				if (this->_file.writable() == false)
+					throw std::runtime_error("mapped_vector: read-only file");
+			};
+
+			/* Helper function: Stores the new size in the header */
+			void	set_size(size_type size)
+			{
+				this->check_writable();
+				this->header()->size = size;
+			};
+
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: Returns the capacity after count expansions */
+			size_type	get_expansion(size_type count) const
+			{
+				const size_type	max = this->max_size();
+				const size_type	cap = this->capacity();
+				if (max - this->size() < count)
+					throw std::length_error("Length error");
+				if (cap >= max / 2)
+					return (max);
+				return (std::max(this->size() + count, std::max(cap * 2, size_type(4096 / sizeof(value_type) + 1))));
+			};
+
+			/* Helper function: Makes room for count elements before pos, growing the file if needed. Returns the index of pos */
+			size_type	open_gap(iterator pos, size_type count)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	size = this->size();
+				this->check_writable();
+				if (this->capacity() - size < count)
+					this->reserve(this->get_expansion(count));
+				std::copy_backward(this->first() + index, this->first() + size, this->first() + size + count);
+				this->set_size(size + count);
+				return (index);
+			};
+
+			/* Helper function: Inserts a single-pass range by appending, then rotating the new elements into place */
+			template <class InputIt>
+			void	range_insert(iterator pos, InputIt first, InputIt last, std::input_iterator_tag)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	old_size = this->size();
+				for (; first != last; ++first)
+					this->push_back(*first);
+				std::rotate(this->first() + index, this->first() + old_size, this->first() + this->size());
+			}
+
+			/* Helper function: Inserts a multi-pass range with one gap */
+			template <class ForwardIt>
+			void	range_insert(iterator pos, ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+			{
+				const size_type	count = std::distance(first, last);
+				const size_type	index = this->open_gap(pos, count);
+				std::copy(first, last, this->first() + index);
+			}
+
+			/* Private member variables */
+			mapped_file	_file;
+	};
+
+	template <typename T>
+	const char	mapped_vector<T>::file_magic[8] = { 'f', 't', 'm', 'a', 'p', 'v', 'e', 'c' };
+
+	/* Lexicographically compares the values in the vector */
+	template <class T>
+	bool	operator==(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T>
+	bool	operator!=(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+}
+
+#endif
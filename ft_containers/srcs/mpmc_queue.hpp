@@ -0,0 +1,233 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mpmc_queue.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:17 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 10:04:17 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <memory>
+# include <limits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "atomic.hpp"
+
+/**
+ * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ *
+ * Bounded queue for any number of producer and consumer threads. Every cell
+ * carries a sequence number telling whose turn it is:
+ *
+ *     sequence == pos             the cell is free for the producer claiming pos
+ *     sequence == pos + 1         the cell holds the element a consumer claiming pos may take
+ *     sequence == pos + capacity  the cell was consumed and is free for the next lap
+ *
+ * Producers and consumers claim positions by compare-exchange on the tail and
+ * head counters, then fill or drain the cell and publish it by bumping its
+ * sequence. Batch operations claim a run of consecutive ready cells with one
+ * compare-exchange. The copy constructor of T must not throw, since a claimed
+ * cell cannot be handed back
+ */
+namespace ft
+{
+	/* Mpmc_queue class */
+	template <class T, class Allocator = std::allocator<T> >
+	class mpmc_queue
+	{
+		public:
+			/* Member types */
+			typedef T										value_type;
+			typedef Allocator								allocator_type;
+			typedef std::size_t								size_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef value_type&								reference;
+			typedef const value_type&						const_reference;
+
+		private:
+			/* Helper types */
+			struct	cell
+			{
+				size_type	_sequence;
+				value_type	_value;
+			};
+			typedef cell*													cell_pointer;
+			typedef typename allocator_type::template rebind<cell>::other	cell_allocator;
+
+		public:
+			/* Constructs an empty queue holding at least capacity elements (rounded up to a power of two) */
+			explicit	mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type()) : _cell_alloc(alloc), _value_alloc(alloc), _cells(NULL), _mask(0), _tail(0), _head(0)
+			{
+				size_type	size = 2;
+
+				if (capacity > this->max_size())
+					throw std::length_error("Length error");
+				while (size < capacity)
+					size <<= 1;
+				this->_cells = this->_cell_alloc.allocate(size);
+				this->_mask = size - 1;
+				for (size_type i = 0; i < size; i++)
+					this->_cells[i]._sequence = i;
+			};
+
+			/* Destructor. Must not race with any other member function */
+			~mpmc_queue()
+			{
+				for (size_type i = this->_head; i != this->_tail; i++)
+					this->_value_alloc.destroy(&this->_cells[i & this->_mask]._value);
+				this->_cell_alloc.deallocate(this->_cells, this->_mask + 1);
+			};
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_value_alloc);
+			};
+
+			/* Capacity: Checks if the queue has no elements at the time of the call */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns a snapshot of the number of claimed elements */
+			size_type	size() const
+			{
+				const size_type	head = atomic_load(&this->_head, memory_order_acquire);
+				const size_type	tail = atomic_load(&this->_tail, memory_order_acquire);
+				return (tail > head ? tail - head : 0);
+			};
+
+			/* Capacity: Returns the maximum number of elements the queue can hold */
+			size_type	capacity() const
+			{
+				return (this->_mask + 1);
+			};
+
+			/* Capacity: Returns the largest capacity the queue can be constructed with */
+			size_type	max_size() const
+			{
+				return (std::min(this->_cell_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max()) / 2));
+			};
+
+			/* Modifiers: Copies value into the queue. Returns false if the queue is full */
+			bool	try_push(const value_type& value)
+			{
+				size_type	pos;
+
+				if (this->claim(this->_tail, 0, 1, pos) == 0)
+					return (false);
+				cell_pointer	ptr = &this->_cells[pos & this->_mask];
+				this->_value_alloc.construct(&ptr->_value, value);
+				atomic_store(&ptr->_sequence, pos + 1, memory_order_release);
+				return (true);
+			};
+
+			/* Modifiers: Copies as many elements of [first, last) as there are free cells. Returns the first element not pushed */
+			template <class ForwardIt>
+			ForwardIt	push_range(ForwardIt first, ForwardIt last)
+			{
+				size_type	pos;
+				size_type	count = this->claim(this->_tail, 0, std::distance(first, last), pos);
+
+				for (size_type i = 0; i < count; i++, ++first)
+				{
+					cell_pointer	ptr = &this->_cells[(pos + i) & this->_mask];
+					this->_value_alloc.construct(&ptr->_value, *first);
+					atomic_store(&ptr->_sequence, pos + i + 1, memory_order_release);
+				}
+				return (first);
+			}
+
+			/* Modifiers: Moves the oldest element into value. Returns false if the queue is empty */
+			bool	try_pop(value_type& value)
+			{
+				size_type	pos;
+
+				if (this->claim(this->_head, 1, 1, pos) == 0)
+					return (false);
+				cell_pointer	ptr = &this->_cells[pos & this->_mask];
+				value = ptr->_value;
+				this->_value_alloc.destroy(&ptr->_value);
+				atomic_store(&ptr->_sequence, pos + this->_mask + 1, memory_order_release);
+				return (true);
+			};
+
+			/* Modifiers: Writes up to count of the oldest elements to out. Returns the number of elements */
+			template <class OutputIt>
+			size_type	pop_range(OutputIt out, size_type count)
+			{
+				size_type	pos;
+
+				count = this->claim(this->_head, 1, count, pos);
+				for (size_type i = 0; i < count; i++, ++out)
+				{
+					cell_pointer	ptr = &this->_cells[(pos + i) & this->_mask];
+					*out = ptr->_value;
+					this->_value_alloc.destroy(&ptr->_value);
+					atomic_store(&ptr->_sequence, pos + i + this->_mask + 1, memory_order_release);
+				}
+				return (count);
+			}
+
+		private:
+			/* Not copyable: the queue is shared by address between threads */
+			mpmc_queue(const mpmc_queue& other);
+			mpmc_queue&	operator=(const mpmc_queue& other);
+
+			/**
+			 * Helper function: Claims up to count consecutive cells from counter, each of which must
+			 * carry sequence position + lag (0 for producers, 1 for consumers). Returns the number of
+			 * cells claimed and their first position in pos
+			 */
+			size_type	claim(size_type& counter, size_type lag, size_type count, size_type& pos)
+			{
+				size_type	ready;
+
+				if (count == 0)
+					return (0);
+				pos = atomic_load(&counter, memory_order_relaxed);
+				while (true)
+				{
+					for (ready = 0; ready < count; ready++)
+					{
+						const size_type	seq = atomic_load(&this->_cells[(pos + ready) & this->_mask]._sequence, memory_order_acquire);
+						if (seq != pos + ready + lag)
+							break ;
+					}
+					if (ready == 0)
+					{
+						const size_type		seq = atomic_load(&this->_cells[pos & this->_mask]._sequence, memory_order_acquire);
+						const difference_type	diff = static_cast<difference_type>(seq - (pos + lag));
+						if (diff < 0)
+							return (0);
+						pos = atomic_load(&counter, memory_order_relaxed);
+						continue ;
+					}
+					if (atomic_compare_exchange(&counter, pos, pos + ready, memory_order_relaxed, memory_order_relaxed))
+						return (ready);
+					cpu_relax();
+				}
+			};
+
+			/* Member objects. Producer and consumer counters sit on separate cache lines */
+			cell_allocator	_cell_alloc;
+			allocator_type	_value_alloc;
+			cell_pointer	_cells;
+			size_type		_mask;
+			char			_pad0[cache_line_size];
+			size_type		_tail;
+			char			_pad1[cache_line_size];
+			size_type		_head;
+			char			_pad2[cache_line_size];
+	};
+}
+
+#endif
@@ -0,0 +1,374 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multiset.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:54:02 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 12:59:08 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTISET_HPP
+# define MULTISET_HPP
+
+# include <memory>
+# include "iterator.hpp"
+# include "rbtree.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/multiset
+ *
+ * Elements with equivalent keys are kept in the order they were inserted.
+ * The node type is the one of ft::set, so nodes extracted from either can
+ * be inserted into the other
+ */
+namespace ft
+{
+	namespace FT_RBTREE_NAMESPACE
+	{
+	/* Multiset class */
+	template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+	class multiset
+	{
+		public:
+			/* Member types */
+			typedef Key												key_type;
+			typedef Key												value_type;
+			typedef std::size_t										size_type;
+			typedef std::ptrdiff_t									difference_type;
+			typedef Compare											key_compare;
+			typedef Compare											value_compare;
+			typedef Allocator										allocator_type;
+			typedef value_type&										reference;
+			typedef const value_type&								const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+
+		private:
+			/* Helper types */
+			typedef rbtree<value_type, value_compare, Allocator>	base;
+
+		public:
+			/* Member types */
+			typedef typename base::const_iterator					iterator;
+			typedef typename base::const_iterator					const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef set_node_handle<Key, Allocator>					node_type;
+
+			/* Default constructor */
+			multiset() : _rbtree(value_compare()) {};
+
+			/* Constructs an empty container with a comparator and allocator */
+			explicit	multiset(const key_compare& comp, const allocator_type& alloc = allocator_type()) : _rbtree(comp, alloc) {};
+
+			/* Constructs the container with the contents of range [first, last) */
+			template <class InputIt>
+			multiset(InputIt first, InputIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _rbtree(comp, alloc)
+			{
+				this->insert(first, last);
+			}
+
+			/* Copy constructor */
+			multiset(const multiset& other) : _rbtree(other._rbtree) {};
+
+			/* Destructor */
+			~multiset() {};
+
+			/* Copy assignation operator */
+			multiset&	operator=(const multiset& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_rbtree = other._rbtree;
+				return (*this);
+			};
+
+			/* Returns the associated allocator */
+			allocator_type	get_allocator() const
+			{
+				return (this->_rbtree.get_allocator());
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			iterator	begin()
+			{
+				return (this->_rbtree.begin());
+			}
+
+			const_iterator	begin() const
+			{
+				return (this->_rbtree.begin());
+			}
+
+			/* Iterators: Returns an iterator to the end */
+			iterator	end()
+			{
+				return (this->_rbtree.end());
+			}
+
+			const_iterator	end() const
+			{
+				return (this->_rbtree.end());
+			}
+
+			/* Iterators: Returns a reverse iterator to the beginning */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			}
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (reverse_iterator(this->end()));
+			}
+
+			/* Iterators: Returns a reverse iterator to the end */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			}
+
+			const_reverse_iterator	rend() const
+			{
+				return (reverse_iterator(this->begin()));
+			}
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->_rbtree.empty());
+			}
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->_rbtree.size());
+			}
+
+			/* Capacity: Returns the maximum possible number of elements */
+			size_type	max_size() const
+			{
+				return (this->_rbtree.max_size());
+			}
+
+			/* Modifiers: Clears the contents */
+			void	clear()
+			{
+				this->_rbtree.clear();
+			}
+
+			/* Modifiers: Inserts value after the elements with an equivalent key */
+			iterator	insert(const value_type& value)
+			{
+				return (this->_rbtree.insert_multi(value));
+			}
+
+			/* Modifiers: Inserts value just before pos if it belongs there, in amortised O(1), so passing the end of a run of equal keys appends to it. Otherwise inserts it like insert(value) */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				return (this->_rbtree.insert_multi(pos, value));
+			}
+
+			/* Modifiers: Inserts elements from range [first, last). Takes O(n) if the range is sorted */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				this->_rbtree.insert_multi(first, last);
+			}
+
+			/* Modifiers: Inserts the node owned by nh after the elements with an equivalent key */
+			iterator	insert(node_type nh)
+			{
+				return (this->_rbtree.insert_multi(nh));
+			}
+
+			/* Modifiers: Inserts the node owned by nh just before pos if it belongs there, or else like insert(nh) */
+			iterator	insert(iterator pos, node_type nh)
+			{
+				return (this->_rbtree.insert_multi(pos, nh));
+			}
+
+			/* Modifiers: Removes the element at pos */
+			void	erase(iterator pos)
+			{
+				this->_rbtree.erase(pos);
+			}
+
+			/* Modifiers: Removes the elements in the range [first, last), which must be a valid range in *this */
+			void	erase(iterator first, iterator last)
+			{
+				this->_rbtree.erase(first, last);
+			}
+
+			/* Modifiers: Removes every element with the key and returns how many there were */
+			size_type	erase(const key_type& key)
+			{
+				return (this->_rbtree.erase_multi(key));
+			}
+
+			/* Modifiers: Removes every element for which pred returns true in one in-order pass and returns how many were removed. Once more than rebuild_fraction of the elements seen were removed, the rest of the tree is rebuilt in O(n) */
+			template <class Predicate>
+			size_type	erase_if(Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+			{
+				return (this->_rbtree.erase_if(pred, rebuild_fraction));
+			}
+
+			/* Modifiers: Unlinks the element at pos and returns a node handle owning it, without copying it */
+			node_type	extract(iterator pos)
+			{
+				return (node_type(this->_rbtree.extract(pos)));
+			}
+
+			/* Modifiers: Unlinks the first element with the key, if there is one, and returns a node handle owning it */
+			node_type	extract(const key_type& key)
+			{
+				iterator	it = this->lower_bound(key);
+
+				if (it == this->end() || this->key_comp()(key, *it))
+					return (node_type());
+				return (this->extract(it));
+			}
+
+			/* Modifiers: Moves every element of source into *this, after the elements with an equivalent key, relinking their nodes without copying them when the allocators are equal */
+			void	merge(multiset& source)
+			{
+				this->_rbtree.merge_multi(source._rbtree);
+			}
+
+			/* Modifiers: Swaps the contents */
+			void	swap(multiset& other)
+			{
+				this->_rbtree.swap(other._rbtree);
+			}
+
+			/* Modifiers: Rebuilds the tree into one block of nodes in key order with minimal height. Invalidates all iterators, pointers and references */
+			void	compact()
+			{
+				this->_rbtree.compact();
+			}
+
+			/* Lookup: Returns the number of elements with the key, in O(log n + count) */
+			size_type	count(const key_type& key) const
+			{
+				return (this->_rbtree.count_multi(key));
+			}
+
+			/* Lookup: Finds an element with the key, not necessarily the first one */
+			iterator	find(const key_type& key)
+			{
+				return (this->_rbtree.find(key));
+			}
+
+			const_iterator	find(const key_type& key) const
+			{
+				return (this->_rbtree.find(key));
+			}
+
+			/* Lookup: Returns the range of elements with the key, in O(log n) */
+			pair<iterator, iterator>	equal_range(const key_type& key)
+			{
+				return (this->_rbtree.equal_range_multi(key));
+			}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& key) const
+			{
+				return (this->_rbtree.equal_range_multi(key));
+			}
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			iterator	lower_bound(const key_type& key)
+			{
+				return (this->_rbtree.lower_bound(key));
+			}
+
+			const_iterator	lower_bound(const key_type& key) const
+			{
+				return (this->_rbtree.lower_bound(key));
+			}
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			iterator	upper_bound(const key_type& key)
+			{
+				return (this->_rbtree.upper_bound(key));
+			}
+
+			const_iterator	upper_bound(const key_type& key) const
+			{
+				return (this->_rbtree.upper_bound(key));
+			}
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_rbtree.value_comp());
+			}
+
+			/* Observers: Returns the function that compares keys in objects of type value_type */
+			value_compare	value_comp() const
+			{
+				return (this->_rbtree.value_comp());
+			}
+
+		private:
+			base	_rbtree;
+	};
+
+	/* Lexicographically compares the values in the multiset */
+	template <class Key, class Compare, class Alloc>
+	bool	operator==(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator!=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator<(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator<=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator>(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class Compare, class Alloc>
+	bool	operator>=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	/* Removes every element for which pred returns true and returns how many were removed */
+	template <class Key, class Compare, class Alloc, class Predicate>
+	typename multiset<Key, Compare, Alloc>::size_type	erase_if(multiset<Key, Compare, Alloc>& c, Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+	{
+		return (c.erase_if(pred, rebuild_fraction));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class Key, class Compare, class Alloc>
+	void	swap(multiset<Key, Compare, Alloc>& lhs, multiset<Key, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+	}
+	using FT_RBTREE_NAMESPACE::swap;
+	using FT_RBTREE_NAMESPACE::erase_if;
+}
+
+#endif
@@ -0,0 +1,203 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:08:47 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:14:05 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_HANDLE_HPP
+# define NODE_HANDLE_HPP
+
+# include <algorithm>
+# include "utility.hpp"
+# include "rbtree_types.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/node_handle
+ *
+ * A node handle owns one node taken out of a map or set with extract(), and
+ * gives it back with insert() without copying the element or touching the
+ * allocator. There are no move semantics in C++98, so like std::auto_ptr,
+ * copying or assigning a handle moves the node: the source is left empty
+ */
+namespace ft
+{
+	namespace FT_RBTREE_NAMESPACE
+	{
+	template <class T, class Compare, class Allocator> class	rbtree;
+
+	/* Node handle class, holding what map and set handles share */
+	template <class T, class Allocator>
+	class node_handle
+	{
+		private:
+			/* Helper types */
+			typedef typename rbt_node_types<T>::node_type						node_type;
+			typedef typename rbt_node_types<T>::node_pointer					node_pointer;
+			typedef typename Allocator::template rebind<node_type>::other		node_allocator;
+
+		public:
+			/* Member types */
+			typedef Allocator	allocator_type;
+
+			/* Constructs an empty handle */
+			node_handle() : _node(NULL), _node_alloc(), _value_alloc() {};
+
+			/* Takes the node of other, which is left empty */
+			node_handle(const node_handle& other) : _node(other._node), _node_alloc(other._node_alloc), _value_alloc(other._value_alloc)
+			{
+				other._node = NULL;
+			};
+
+			/* Destroys the element and frees the node if the handle is not empty */
+			~node_handle()
+			{
+				this->reset();
+			};
+
+			/* Frees the node held, then takes the node of other, which is left empty */
+			node_handle&	operator=(const node_handle& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->reset();
+				this->_node = other._node;
+				this->_node_alloc = other._node_alloc;
+				this->_value_alloc = other._value_alloc;
+				other._node = NULL;
+				return (*this);
+			};
+
+			/* Checks whether the handle holds no node */
+			bool	empty() const
+			{
+				return (this->_node == NULL);
+			};
+
+			/* Returns the allocator of the container the node came from */
+			allocator_type	get_allocator() const
+			{
+				return (this->_value_alloc);
+			};
+
+			/* Swaps the nodes of two handles */
+			void	swap(node_handle& other)
+			{
+				std::swap(this->_node, other._node);
+				std::swap(this->_node_alloc, other._node_alloc);
+				std::swap(this->_value_alloc, other._value_alloc);
+			};
+
+		protected:
+			/* Returns the element in the node, which must not be empty */
+			T&	element() const
+			{
+				return (this->_node->_value);
+			};
+
+		private:
+			/* The tree creates handles and takes their nodes back */
+			template <class, class, class> friend class	rbtree;
+
+			/* Constructor with a node unlinked from a tree and the allocators of that tree */
+			node_handle(node_pointer node, const node_allocator& node_alloc, const allocator_type& value_alloc) : _node(node), _node_alloc(node_alloc), _value_alloc(value_alloc) {};
+
+			/* Gives up the node without freeing it. Const, like the copy constructor, as _node is mutable */
+			node_pointer	release() const
+			{
+				node_pointer	node = this->_node;
+
+				this->_node = NULL;
+				return (node);
+			};
+
+			/* Destroys the element and frees the node */
+			void	reset()
+			{
+				if (this->_node == NULL)
+					return ;
+				this->_value_alloc.destroy(&this->_node->_value);
+				this->_node_alloc.deallocate(this->_node, 1);
+				this->_node = NULL;
+			};
+
+			/* Private member variables */
+			mutable node_pointer	_node;
+			node_allocator			_node_alloc;
+			allocator_type			_value_alloc;
+	};
+
+	/* Node handle of a map, giving access to the key and mapped value */
+	template <class Key, class T, class Allocator>
+	class map_node_handle : public node_handle<pair<const Key, T>, Allocator>
+	{
+		private:
+			/* Helper types */
+			typedef node_handle<pair<const Key, T>, Allocator>	base;
+
+		public:
+			/* Member types */
+			typedef Key	key_type;
+			typedef T	mapped_type;
+
+			/* Constructs an empty handle */
+			map_node_handle() : base() {};
+
+			/* Takes the node of other, which is left empty */
+			map_node_handle(const base& other) : base(other) {};
+
+			/* Returns the key, which may be changed before the node is inserted again */
+			key_type&	key() const
+			{
+				return (const_cast<key_type&>(this->element().first));
+			};
+
+			/* Returns the mapped value */
+			mapped_type&	mapped() const
+			{
+				return (this->element().second);
+			};
+	};
+
+	/* Node handle of a set, giving access to the value */
+	template <class Value, class Allocator>
+	class set_node_handle : public node_handle<Value, Allocator>
+	{
+		private:
+			/* Helper types */
+			typedef node_handle<Value, Allocator>	base;
+
+		public:
+			/* Member types */
+			typedef Value	value_type;
+
+			/* Constructs an empty handle */
+			set_node_handle() : base() {};
+
+			/* Takes the node of other, which is left empty */
+			set_node_handle(const base& other) : base(other) {};
+
+			/* Returns the value, which may be changed before the node is inserted again */
+			value_type&	value() const
+			{
+				return (this->element());
+			};
+	};
+
+	/* Result of inserting a node handle: where the element is, whether it was inserted, and the node back if not */
+	template <class Iterator, class NodeType>
+	struct	node_insert_return
+	{
+		Iterator	position;
+		bool		inserted;
+		NodeType	node;
+	};
+	}
+}
+
+#endif
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   offset_ptr.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:02:37 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 21:02:37 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OFFSET_PTR_HPP
+# define OFFSET_PTR_HPP
+
+# include <cstddef>
+
+/**
+ * https://www.boost.org/doc/libs/release/doc/html/interprocess/offset_ptr.html
+ *
+ * Pointer that stores the distance from its own address to the target
+ * instead of the target's address. A structure of offset_ptrs keeps its
+ * links when the memory holding it is mapped at another address, such as a
+ * file mapped by another process or after a remap. Copying one recomputes
+ * the distance from the new location. A distance of 1 means NULL, since no
+ * object can start one byte into the pointer itself
+ */
+namespace ft
+{
+	/* Offset_ptr class */
+	template <class T>
+	class offset_ptr
+	{
+		public:
+			/* Member types */
+			typedef T	element_type;
+			typedef T*	pointer;
+			typedef T&	reference;
+
+			/* Orthodox canonical form */
+			offset_ptr() : _offset(1) {};
+			offset_ptr(const offset_ptr& other)
+			{
+				this->set(other.get());
+			};
+			~offset_ptr() {};
+			offset_ptr&	operator=(const offset_ptr& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->set(other.get());
+				return (*this);
+			};
+
+			/* Points to ptr */
+			offset_ptr(pointer ptr)
+			{
+				this->set(ptr);
+			};
+
+			offset_ptr&	operator=(pointer ptr)
+			{
+				this->set(ptr);
+				return (*this);
+			};
+
+			/* Returns the raw address of the target */
+			pointer	get() const
+			{
+				if (this->_offset == 1)
+					return (NULL);
+				return (reinterpret_cast<pointer>(const_cast<char *>(reinterpret_cast<const char *>(this)) + this->_offset));
+			};
+
+			/* Converts to the raw address, so offset_ptrs compare with raw pointers and NULL */
+			operator pointer() const
+			{
+				return (this->get());
+			};
+
+			/* Accesses the target */
+			reference	operator*() const
+			{
+				return (*this->get());
+			};
+
+			pointer	operator->() const
+			{
+				return (this->get());
+			};
+
+		private:
+			/* Helper function: Stores the distance to ptr */
+			void	set(pointer ptr)
+			{
+				if (ptr == NULL)
+					this->_offset = 1;
+				else
+					this->_offset = reinterpret_cast<const char *>(ptr) - reinterpret_cast<const char *>(this);
+			};
+
+			/* Member object */
+			std::ptrdiff_t	_offset;
+	};
+}
+
+#endif
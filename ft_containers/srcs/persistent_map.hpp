@@ -0,0 +1,599 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:02:37 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:39:02 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <functional>
+# include <algorithm>
+# include <stdexcept>
+# include "map.hpp"
+# include "offset_ptr.hpp"
+# include "mapped_file.hpp"
+
+/**
+ * https://www.boost.org/doc/libs/release/doc/html/interprocess/allocators_containers.html
+ *
+ * Map whose red-black tree lives in a memory-mapped file. Nodes link to each
+ * other with offset_ptrs, so the tree is valid wherever the file is mapped:
+ * reopening it gives a usable map at once, and several processes can map it
+ * read-only and share the same pages. Nodes come from a bump allocator inside
+ * the mapping with a free list for erased nodes; when it runs out, the file
+ * grows and is mapped again, which invalidates iterators.
+ *
+ * Keys and values are stored as raw bytes, so both must be trivially
+ * copyable. The comparator is not stored and must order keys the same way
+ * every time the file is opened.
+ *
+ * A read-only mapping cannot be written to, so on a map opened read-only the
+ * non-const lookups and iterators throw like the modifiers do: read such a
+ * map through a const reference
+ */
+namespace ft
+{
+	/* Node of a persistent tree. Never constructed: it is laid over bytes of the mapping */
+	template <class T>
+	class	persistent_node
+	{
+		public:
+			/* Public member objects */
+			offset_ptr<persistent_node>	_left;
+			offset_ptr<persistent_node>	_right;
+			offset_ptr<persistent_node>	_parent;
+			bool						_black;
+			T							_value;
+
+			/* Getter and setter function for parent of node */
+			persistent_node	*get_parent_ptr() const { return (this->_parent.get()); };
+			void	set_parent_ptr(persistent_node *parent) { this->_parent = parent; };
+	};
+
+	/* Bidirectional iterator over the nodes of a persistent tree */
+	template <class Node, class Value>
+	class persistent_tree_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::bidirectional_iterator_tag	iterator_category;
+			typedef Value							value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef Value&							reference;
+			typedef Value*							pointer;
+
+			/* Orthodox canonical form */
+			persistent_tree_iterator() : _node(NULL) {};
+			template <class V> persistent_tree_iterator(const persistent_tree_iterator<Node, V>& other) : _node(other.node()) {}
+			~persistent_tree_iterator() {};
+			persistent_tree_iterator&	operator=(const persistent_tree_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_node = other._node;
+				return (*this);
+			};
+
+			/* Constructor with node */
+			explicit	persistent_tree_iterator(Node *node) : _node(node) {};
+
+			/* Returns the underlying node */
+			Node	*node() const
+			{
+				return (this->_node);
+			};
+
+			/* Accesses the pointed-to element */
+			reference	operator*() const
+			{
+				return (this->_node->_value);
+			};
+
+			pointer	operator->() const
+			{
+				return (&this->_node->_value);
+			};
+
+			/* Advances of decrements the iterator */
+			persistent_tree_iterator&	operator++()
+			{
+				this->_node = iter_to_next<Node *>(this->_node);
+				return (*this);
+			};
+
+			persistent_tree_iterator	operator++(int)
+			{
+				persistent_tree_iterator	it = *this;
+				++(*this);
+				return (it);
+			};
+
+			persistent_tree_iterator&	operator--()
+			{
+				this->_node = iter_to_prev<Node *, Node *>(this->_node);
+				return (*this);
+			};
+
+			persistent_tree_iterator	operator--(int)
+			{
+				persistent_tree_iterator	it = *this;
+				--(*this);
+				return (it);
+			};
+
+		private:
+			/* Member object */
+			Node	*_node;
+	};
+
+	/* Compares the underlying nodes */
+	template <class Node, class V1, class V2>
+	bool	operator==(const persistent_tree_iterator<Node, V1>& lhs, const persistent_tree_iterator<Node, V2>& rhs)
+	{
+		return (lhs.node() == rhs.node());
+	}
+
+	template <class Node, class V1, class V2>
+	bool	operator!=(const persistent_tree_iterator<Node, V1>& lhs, const persistent_tree_iterator<Node, V2>& rhs)
+	{
+		return (lhs.node() != rhs.node());
+	}
+
+	/* Persistent_map class */
+	template <class Key, class T, class Compare = std::less<Key> >
+	class persistent_map
+	{
+		private:
+			/* Keys and values are written to the file as raw bytes */
+			typedef char	keys_must_be_trivially_copyable[is_trivially_copyable<Key>::value ? 1 : -1];
+			typedef char	values_must_be_trivially_copyable[is_trivially_copyable<T>::value ? 1 : -1];
+
+		public:
+			/* Member types */
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef pair<const Key, T>												value_type;
+			typedef std::size_t														size_type;
+			typedef std::ptrdiff_t													difference_type;
+			typedef Compare															key_compare;
+			typedef value_type&														reference;
+			typedef const value_type&												const_reference;
+			typedef value_type*														pointer;
+			typedef const value_type*												const_pointer;
+
+		private:
+			/* Helper types */
+			typedef persistent_node<value_type>										node_type;
+			typedef node_type*														node_pointer;
+			typedef vt_compare<key_type, value_type, key_compare>					value_compare_type;
+
+		public:
+			/* Member types */
+			typedef persistent_tree_iterator<node_type, value_type>					iterator;
+			typedef persistent_tree_iterator<node_type, const value_type>			const_iterator;
+			typedef ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+			/* Opens the map stored in path, creating an empty one when a writable file is missing */
+			explicit	persistent_map(const char *path, bool writable = true, const key_compare& comp = key_compare()) : _file(path, writable), _comp(comp)
+			{
+				if (this->_file.size() == 0 && writable)
+					this->format();
+				if (this->_file.size() < node_area
+					|| std::memcmp(this->header()->magic, file_magic, sizeof(file_magic)) != 0
+					|| this->header()->value_size != sizeof(value_type)
+					|| this->header()->used > this->_file.size() - node_area)
+					throw std::runtime_error("persistent_map: invalid file");
+			};
+
+			/* Deconstructor. Unmaps the file without forcing the changes to disk */
+			~persistent_map() {};
+
+			/* Writes every change to the file and waits until it is on disk */
+			void	sync()
+			{
+				this->_file.sync();
+			};
+
+			/* Returns whether the file was opened for writing */
+			bool	writable() const
+			{
+				return (this->_file.writable());
+			};
+
+			/* Element access: Returns a reference to the mapped value of the element with key, with bounds checking */
+			T&	at(const Key& key)
+			{
+				iterator	it = this->find(key);
+				if (it == this->end())
+					throw std::out_of_range("Out of range");
+				return (it->second);
+			};
+
+			const T&	at(const Key& key) const
+			{
+				const_iterator	it = this->find(key);
+				if (it == this->end())
+					throw std::out_of_range("Out of range");
+				return (it->second);
+			};
+
+			/* Element access: Returns a reference to the value that is mapped to key, inserting it if it does not exist */
+			T&	operator[](const Key& key)
+			{
+				return (this->insert(ft::make_pair(key, T())).first->second);
+			};
+
+			/* Iterators: Returns an iterator to the beginning */
+			iterator	begin()
+			{
+				this->check_writable();
+				return (iterator(this->header()->leftmost.get()));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->header()->leftmost.get()));
+			};
+
+			/* Iterators: Returns an iterator to the end */
+			iterator	end()
+			{
+				this->check_writable();
+				return (iterator(this->end_node()));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this->end_node()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the beginning */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the end */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks whether the container is empty */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns the number of elements */
+			size_type	size() const
+			{
+				return (this->header()->size);
+			};
+
+			/* Capacity: Returns the maximum possible number of elements */
+			size_type	max_size() const
+			{
+				return ((static_cast<size_type>(std::numeric_limits<off_t>::max()) - node_area) / sizeof(node_type));
+			};
+
+			/* Modifiers: Clears the contents. The file keeps its size */
+			void	clear()
+			{
+				this->check_writable();
+				this->end_node()->_left = NULL;
+				this->header()->leftmost = this->end_node();
+				this->header()->free_list = NULL;
+				this->header()->size = 0;
+				this->header()->used = 0;
+			};
+
+			/* Modifiers: Inserts value */
+			pair<iterator, bool>	insert(const value_type& value)
+			{
+				const value_type	copy = value;
+				node_pointer		parent;
+				node_pointer		node;
+				bool				left = true;
+
+				this->reserve_node();
+				parent = this->end_node();
+				node = this->root();
+				while (node != NULL)
+				{
+					parent = node;
+					left = this->_comp(copy, node->_value);
+					if (left)
+						node = node->_left;
+					else if (this->_comp(node->_value, copy))
+						node = node->_right;
+					else
+						return (ft::make_pair(iterator(node), false));
+				}
+				return (ft::make_pair(this->insert_node(parent, left, copy), true));
+			};
+
+			/* Modifiers: Inserts value. The hint is not used, since finding the position is O(log n) either way */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				(void)pos;
+				return (this->insert(value).first);
+			};
+
+			/* Modifiers: Inserts elements from range [first, last) */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				for (; first != last; ++first)
+					this->insert(*first);
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				node_pointer	node = pos.node();
+				iterator		next = pos;
+
+				this->check_writable();
+				++next;
+				if (this->header()->leftmost.get() == node)
+					this->header()->leftmost = next.node();
+				btree_delete(this->root(), node);
+				node->_right = this->header()->free_list;
+				this->header()->free_list = node;
+				this->header()->size--;
+				return (next);
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			void	erase(iterator first, iterator last)
+			{
+				while (first != last)
+					first = this->erase(first);
+			};
+
+			/* Modifiers: Removes the element (if one exists) with the key */
+			size_type	erase(const Key& key)
+			{
+				iterator	it = this->find(key);
+
+				if (it == this->end())
+					return (0);
+				this->erase(it);
+				return (1);
+			};
+
+			/* Lookup: Returns the number of elements matching specific key */
+			size_type	count(const Key& key) const
+			{
+				return (this->find(key) == this->end() ? 0 : 1);
+			};
+
+			/* Lookup: Finds element with specific key */
+			iterator	find(const Key& key)
+			{
+				this->check_writable();
+				return (iterator(this->find_node(key)));
+			};
+
+			const_iterator	find(const Key& key) const
+			{
+				return (const_iterator(this->find_node(key)));
+			};
+
+			/* Lookup: Returns a range containing all elements with the given key */
+			pair<iterator, iterator>	equal_range(const Key& key)
+			{
+				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+			};
+
+			pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+			};
+
+			/* Lookup: Returns an iterator to the first element not less than the given key */
+			iterator	lower_bound(const Key& key)
+			{
+				this->check_writable();
+				return (iterator(this->bound_node(key, false)));
+			};
+
+			const_iterator	lower_bound(const Key& key) const
+			{
+				return (const_iterator(this->bound_node(key, false)));
+			};
+
+			/* Lookup: Returns an iterator to the first element greater than the given key */
+			iterator	upper_bound(const Key& key)
+			{
+				this->check_writable();
+				return (iterator(this->bound_node(key, true)));
+			};
+
+			const_iterator	upper_bound(const Key& key) const
+			{
+				return (const_iterator(this->bound_node(key, true)));
+			};
+
+			/* Observers: Returns the function that compares keys */
+			key_compare	key_comp() const
+			{
+				return (this->_comp.key_comp());
+			};
+
+		private:
+			/* Layout of the start of the file. The end node's left child is the root */
+			struct	file_header
+			{
+				char					magic[8];
+				size_type				value_size;
+				size_type				size;
+				size_type				used;
+				node_type				end_node;
+				offset_ptr<node_type>	leftmost;
+				offset_ptr<node_type>	free_list;
+			};
+
+			/* Nodes start on a cache line after the header */
+			static const size_type	node_area = (sizeof(file_header) + 63) / 64 * 64;
+			static const size_type	initial_nodes = 64;
+			static const char		file_magic[8];
+
+			/* Not copyable: two objects would map the same file */
+			persistent_map(const persistent_map&);
+			persistent_map&	operator=(const persistent_map&);
+
+			/* Helper function: Returns the header at the start of the mapping */
+			file_header	*header() const
+			{
+				return (reinterpret_cast<file_header *>(this->_file.data()));
+			};
+
+			/* Helper function: Returns the end node */
+			node_pointer	end_node() const
+			{
+				return (&this->header()->end_node);
+			};
+
+			/* Helper function: Returns the root node */
+			node_pointer	root() const
+			{
+				return (this->end_node()->_left);
+			};
+
+			/* Helper function: Throws std::runtime_error before a write to a read-only file */
+			void	check_writable() const
+			{
+				if (this->_file.writable() == false)
+					throw std::runtime_error("persistent_map: read-only file");
+			};
+
+			/* Helper function: Lays out an empty map in a new file */
+			void	format()
+			{
+				this->_file.resize(node_area + initial_nodes * sizeof(node_type));
+				std::memcpy(this->header()->magic, file_magic, sizeof(file_magic));
+				this->header()->value_size = sizeof(value_type);
+				this->header()->size = 0;
+				this->header()->used = 0;
+				this->end_node()->_left = NULL;
+				this->end_node()->_right = NULL;
+				this->end_node()->_parent = NULL;
+				this->end_node()->_black = true;
+				this->header()->leftmost = this->end_node();
+				this->header()->free_list = NULL;
+			};
+
+			/* Helper function: Makes sure a node can be taken without growing the file, so no pointer is invalidated while linking it */
+			void	reserve_node()
+			{
+				const size_type	area = this->_file.size() - node_area;
+
+				this->check_writable();
+				if (this->header()->free_list != NULL || this->header()->used + sizeof(node_type) <= area)
+					return ;
+				if (area > this->max_size() * sizeof(node_type) / 2)
+					throw std::length_error("Length error");
+				this->_file.resize(node_area + std::max(area * 2, initial_nodes * sizeof(node_type)));
+			};
+
+			/* Helper function: Takes a node from the free list or the unused end of the node area */
+			node_pointer	take_node()
+			{
+				node_pointer	node = this->header()->free_list;
+
+				if (node != NULL)
+				{
+					this->header()->free_list = node->_right;
+					return (node);
+				}
+				node = reinterpret_cast<node_pointer>(this->_file.data() + node_area + this->header()->used);
+				this->header()->used += sizeof(node_type);
+				return (node);
+			};
+
+			/* Helper function: Links a new node holding value below parent and rebalances */
+			iterator	insert_node(node_pointer parent, bool left, const value_type& value)
+			{
+				node_pointer	node = this->take_node();
+
+				node->_left = NULL;
+				node->_right = NULL;
+				node->_parent = parent;
+				std::allocator<value_type>().construct(&node->_value, value);
+				if (left)
+					parent->_left = node;
+				else
+					parent->_right = node;
+				if (this->header()->leftmost->_left != NULL)
+					this->header()->leftmost = this->header()->leftmost->_left.get();
+				this->header()->size++;
+				btree_insert(this->root(), node);
+				return (iterator(node));
+			};
+
+			/* Helper function: Returns the node holding key, or the end node */
+			node_pointer	find_node(const Key& key) const
+			{
+				node_pointer	node = this->root();
+
+				while (node != NULL)
+				{
+					if (this->_comp(key, node->_value))
+						node = node->_left;
+					else if (this->_comp(node->_value, key))
+						node = node->_right;
+					else
+						return (node);
+				}
+				return (this->end_node());
+			};
+
+			/* Helper function: Returns the first node whose key is not less than key, or greater than key when upper is set */
+			node_pointer	bound_node(const Key& key, bool upper) const
+			{
+				node_pointer	pos = this->end_node();
+				node_pointer	node = this->root();
+
+				while (node != NULL)
+				{
+					if (upper ? this->_comp(key, node->_value) : !this->_comp(node->_value, key))
+					{
+						pos = node;
+						node = node->_left;
+					}
+					else
+						node = node->_right;
+				}
+				return (pos);
+			};
+
+			/* Private member variables */
+			mapped_file	_file;
+			value_compare_type	_comp;
+	};
+
+	template <class Key, class T, class Compare>
+	const char	persistent_map<Key, T, Compare>::file_magic[8] = { 'f', 't', 'p', 'm', 'a', 'p', '0', '1' };
+}
+
+#endif
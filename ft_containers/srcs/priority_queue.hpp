@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:36 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 11:02:36 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include <functional>
+# include "heap_algorithm.hpp"
+# include "vector.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/priority_queue
+ */
+namespace ft
+{
+	/* Priority_queue class. Keeps the underlying container as an Arity-ary heap (see heap_algorithm.hpp) */
+	template <class T, class Container = vector<T>, class Compare = std::less<typename Container::value_type>, std::size_t Arity = 4>
+	class priority_queue
+	{
+		private:
+			/* A heap needs at least two children per node */
+			typedef char	arity_must_be_at_least_two[Arity >= 2 ? 1 : -1];
+
+		public:
+			/* Member types */
+			typedef Container							container_type;
+			typedef Compare								value_compare;
+			typedef typename Container::value_type		value_type;
+			typedef typename Container::size_type		size_type;
+			typedef typename Container::reference		reference;
+			typedef typename Container::const_reference	const_reference;
+
+			/* Copy-constructs the underlying container c with the contents of cont, then turns it into a heap */
+			explicit	priority_queue(const value_compare& compare = value_compare(), const container_type& cont = container_type()) : c(cont), comp(compare)
+			{
+				ft::make_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			};
+
+			/* Appends the range [first, last) to cont and builds the heap in O(n) */
+			template <class InputIt>
+			priority_queue(InputIt first, InputIt last, const value_compare& compare = value_compare(), const container_type& cont = container_type()) : c(cont), comp(compare)
+			{
+				this->c.insert(this->c.end(), first, last);
+				ft::make_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			}
+
+			/* Copy constructor */
+			priority_queue(const priority_queue& other) : c(other.c), comp(other.comp) {};
+
+			/* Destructor */
+			~priority_queue() {};
+
+			/* Copy assignation operator */
+			priority_queue&	operator=(const priority_queue& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->c = other.c;
+				this->comp = other.comp;
+				return (*this);
+			};
+
+			/* Element access: Returns reference to the top element in the priority queue */
+			const_reference	top() const
+			{
+				return (this->c.front());
+			};
+
+			/* Capacity: Checks if the underlying container has no elements */
+			bool	empty() const
+			{
+				return (this->c.empty());
+			};
+
+			/* Capacity: Returns the number of elements in the underlying container */
+			size_type	size() const
+			{
+				return (this->c.size());
+			};
+
+			/* Modifiers: Inserts element and sorts the underlying container */
+			void	push(const value_type& value)
+			{
+				this->c.push_back(value);
+				ft::push_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			};
+
+			/**
+			 * Modifiers: Inserts the elements of range [first, last). The new elements are appended at once,
+			 * then sifted up one by one when there are few of them, or the whole container is heapified
+			 * again in O(n) when that is cheaper
+			 */
+			template <class InputIt>
+			void	push_range(InputIt first, InputIt last)
+			{
+				const size_type	old_size = this->c.size();
+				size_type		added;
+				size_type		height = 1;
+
+				this->c.insert(this->c.end(), first, last);
+				added = this->c.size() - old_size;
+				for (size_type n = old_size; n >= Arity; n /= Arity)
+					height++;
+				if (added * height < this->c.size())
+					for (size_type i = old_size; i < this->c.size(); i++)
+						ft::push_heap<Arity>(this->c.begin(), this->c.begin() + (i + 1), this->comp);
+				else
+					ft::make_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			}
+
+			/* Modifiers: Removes the top element from the priority queue */
+			void	pop()
+			{
+				ft::pop_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+				this->c.pop_back();
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(priority_queue& other)
+			{
+				this->c.swap(other.c);
+				std::swap(this->comp, other.comp);
+			};
+
+		protected:
+			/* Member objects */
+			container_type	c;
+			value_compare	comp;
+	};
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void	swap(priority_queue<T, Container, Compare, Arity>& lhs, priority_queue<T, Container, Compare, Arity>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
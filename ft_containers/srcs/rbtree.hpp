@@ -6,18 +6,25 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/16 14:56:56 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/23 17:31:34 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 13:14:22 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef RBTREE_HPP
 # define RBTREE_HPP
 
+# include <climits>
 # include <algorithm>
 # include "rbtree_iterator.hpp"
+# include "node_handle.hpp"
 
 namespace ft
 {
+	namespace FT_RBTREE_NAMESPACE
+	{
+	/* Share of removed elements above which erase_if stops erasing node by node and rebuilds the rest of the tree */
+	const double	erase_if_rebuild_fraction = 0.25;
+
 	/* Red-black tree class */
 	template <class T, class Compare, class Allocator>
 	class rbtree
@@ -35,6 +42,7 @@ namespace ft
 			typedef typename allocator_type::pointer							pointer;
 			typedef const_tree_iterator<value_type, difference_type>			const_iterator;
 			typedef tree_iterator<value_type, difference_type>					iterator;
+			typedef node_handle<value_type, allocator_type>						node_handle_type;
 
 		private:
 			/* Helper types */
@@ -46,15 +54,15 @@ namespace ft
 
 		public:
 			/* Constructor with value_compare */
-			rbtree(const value_compare& comp) : _node_alloc(node_allocator()), _value_alloc(allocator_type()), _comp(comp), _leaf_node(leaf_node_type()), _leaf_node_ptr(this->end_node()), _size(0) {};
+			rbtree(const value_compare& comp) : _node_alloc(node_allocator()), _value_alloc(allocator_type()), _comp(comp), _leaf_node(leaf_node_type()), _leaf_node_ptr(this->end_node()), _size(0), _slab(NULL), _slab_size(0), _slab_used(0), _slab_free(NULL) {};
 
 			/* Constructor with value_compare and allocator_type */
-			rbtree(const value_compare& comp, const allocator_type& alloc) : _node_alloc(node_allocator()), _value_alloc(alloc), _comp(comp), _leaf_node(leaf_node_type()), _leaf_node_ptr(this->end_node()), _size(0) {};
+			rbtree(const value_compare& comp, const allocator_type& alloc) : _node_alloc(node_allocator()), _value_alloc(alloc), _comp(comp), _leaf_node(leaf_node_type()), _leaf_node_ptr(this->end_node()), _size(0), _slab(NULL), _slab_size(0), _slab_used(0), _slab_free(NULL) {};
 
 			/* Copy constructor */
-			rbtree(const rbtree& other) : _node_alloc(other._node_alloc), _value_alloc(other._value_alloc), _comp(other._comp), _leaf_node(), _leaf_node_ptr(this->end_node()), _size(0)
+			rbtree(const rbtree& other) : _node_alloc(other._node_alloc), _value_alloc(other._value_alloc), _comp(other._comp), _leaf_node(), _leaf_node_ptr(this->end_node()), _size(0), _slab(NULL), _slab_size(0), _slab_used(0), _slab_free(NULL)
 			{
-				insert(other.begin(), other.end());
+				this->assign_sorted(other.begin(), other.end());
 			};
 
 			/* Destructor */
@@ -123,7 +131,7 @@ namespace ft
 			void	clear()
 			{
 				this->destroy(this->root());
-				this->_leaf_node._left = NULL;
+				this->_leaf_node = leaf_node_type();
 				this->_leaf_node_ptr = this->end_node();
 				this->_size = 0;
 			}
@@ -157,6 +165,89 @@ namespace ft
 				return (it);
 			}
 
+			/* Modifiers: Inserts the node owned by nh, which must come from a tree with an equal allocator. Leaves nh empty if it was inserted */
+			pair<iterator, bool>	insert(node_handle_type& nh)
+			{
+				leaf_node_pointer	parent;
+
+				if (nh.empty())
+					return (ft::make_pair(this->end(), false));
+				node_pointer&		child_ref = get_pos_key(parent, nh._node->_value);
+				if (child_ref != NULL)
+					return (ft::make_pair(iterator(child_ref), false));
+				return (ft::make_pair(this->link_node(child_ref, parent, nh.release()), true));
+			}
+
+			/* Modifiers: Inserts the node owned by nh in the position as close as possible to the position just prior to pos. Takes nh by const reference so temporary handles bind */
+			iterator	insert(const_iterator pos, const node_handle_type& nh)
+			{
+				leaf_node_pointer	parent;
+				node_pointer		temp;
+
+				if (nh.empty())
+					return (this->end());
+				node_pointer&		child = get_pos_iterator(iterator(pos.base()), parent, nh._node->_value, temp);
+				if (child != NULL)
+					return (iterator(child));
+				return (this->link_node(child, parent, nh.release()));
+			}
+
+			/**
+			 * Modifiers: Inserts value after the elements with an equivalent key, so equal keys keep the order they
+			 * were inserted in. The following *_multi functions are what multimap and multiset build on
+			 */
+			iterator	insert_multi(const value_type& value)
+			{
+				leaf_node_pointer	parent;
+				node_pointer&		child = this->get_pos_multi(parent, value);
+
+				return (this->insert_pos(child, parent, value));
+			}
+
+			/**
+			 * Modifiers: Inserts value just before pos when it belongs there, in amortised O(1). So passing the end
+			 * of a run of equal keys appends to it, and passing end() appends sorted input. As equal keys keep their
+			 * insertion order, value never goes before an equal element: then, or if pos is wrong, it is inserted
+			 * like insert_multi(value)
+			 */
+			iterator	insert_multi(const_iterator pos, const value_type& value)
+			{
+				leaf_node_pointer	parent;
+				node_pointer&		child = this->get_pos_multi(pos, parent, value);
+
+				return (this->insert_pos(child, parent, value));
+			}
+
+			/* Modifiers: Inserts elements from range [first, last), each one hinted at the end so sorted ranges take O(n) */
+			template <class InputIt>
+			void	insert_multi(InputIt first, InputIt last)
+			{
+				for (; first != last; ++first)
+					this->insert_multi(this->end(), *first);
+			}
+
+			/* Modifiers: Inserts the node owned by nh after the elements with an equivalent key and leaves nh empty */
+			iterator	insert_multi(node_handle_type& nh)
+			{
+				leaf_node_pointer	parent;
+
+				if (nh.empty())
+					return (this->end());
+				node_pointer&		child = this->get_pos_multi(parent, nh._node->_value);
+				return (this->link_node(child, parent, nh.release()));
+			}
+
+			/* Modifiers: Inserts the node owned by nh just before pos like insert_multi(pos, value) and leaves nh empty */
+			iterator	insert_multi(const_iterator pos, node_handle_type& nh)
+			{
+				leaf_node_pointer	parent;
+
+				if (nh.empty())
+					return (this->end());
+				node_pointer&		child = this->get_pos_multi(pos, parent, nh._node->_value);
+				return (this->link_node(child, parent, nh.release()));
+			}
+
 			/* Modifiers: Inserts elements from rnage [first, last] */
 			template <class InputIt>
 			void	insert(InputIt first, InputIt last)
@@ -165,28 +256,90 @@ namespace ft
 					insert(*first);
 			}
 
+			/* Modifiers: Replaces the contents with the range [first, last), which must be sorted and hold no equivalent elements. Takes O(n) */
+			template <class ForwardIt>
+			void	assign_sorted(ForwardIt first, ForwardIt last)
+			{
+				const size_type	count = static_cast<size_type>(std::distance(first, last));
+				size_type		red_depth = 0;
+
+				this->clear();
+				if (count == 0)
+					return ;
+				while ((count >> (red_depth + 1)) != 0)
+					red_depth++;
+				this->end_node()->_left = this->build_sorted(first, count, this->end_node(), 0, red_depth);
+				this->_leaf_node_ptr = most_left_node(this->root());
+				this->_size = count;
+				this->thread_nodes();
+			}
+
 			/* Modifiers: Removes the element at pos */
 			iterator	erase(const_iterator pos)
 			{
 				const_iterator	next(pos);
 				++next;
 
-				if (this->_leaf_node_ptr == pos.base())
-					this->_leaf_node_ptr = next.base();
-				
-				node_pointer	ptr = pos.node_ptr();
-				btree_delete(end_node()->_left, ptr);
+				node_pointer	ptr = this->unlink_node(pos);
 				this->_value_alloc.destroy(&ptr->_value);
-				this->_node_alloc.deallocate(ptr, 1);
-				this->_size--;
+				this->deallocate_node(ptr);
 				return (iterator(next.base()));
 			}
 
-			/* Modifiers: Removes the elements in the range [first, last), which must be a valid range in *this */
+			/**
+			 * Modifiers: Removes the elements in the range [first, last), which must be a valid range in *this.
+			 * Erasing every element is a clear(). Longer ranges are cut out of the tree with two splits and one
+			 * join, so the k erased nodes only cost their destruction on top of O(log n) rebalancing, instead
+			 * of one rebalance per node. Short ranges are erased one node at a time
+			 */
 			void	erase(const_iterator first, const_iterator last)
 			{
-				while (first != last)
-					first = erase(first);
+				size_type	count = 0;
+
+				if (first == this->begin() && last == this->end())
+				{
+					this->clear();
+					return ;
+				}
+				for (const_iterator it = first; it != last && count < erase_split_threshold; ++it)
+					count++;
+				if (count < erase_split_threshold)
+				{
+					while (first != last)
+						first = erase(first);
+					return ;
+				}
+				this->erase_split(first.node_ptr(), last.base());
+			}
+
+			/**
+			 * Modifiers: Removes every element for which pred returns true in one in-order pass and returns how
+			 * many were removed. Elements are erased in place while few match, but once more than rebuild_fraction
+			 * of the elements seen so far were removed, the tree is split at the current element and the rest of
+			 * the pass frees the matches and relinks the survivors into a balanced tree in O(n), which is joined
+			 * back. If pred throws, the elements it already selected are removed and the tree stays valid
+			 */
+			template <class Predicate>
+			size_type	erase_if(Predicate pred, double rebuild_fraction)
+			{
+				const size_type	size = this->_size;
+				size_type		visited = 0;
+				const_iterator	it(this->_leaf_node_ptr);
+
+				while (it.base() != this->end_node())
+				{
+					if (visited >= erase_if_sample && size - this->_size > rebuild_fraction * visited)
+					{
+						this->erase_rebuild(it.node_ptr(), pred);
+						break ;
+					}
+					visited++;
+					if (pred(it.node_ptr()->_value))
+						it = this->erase(it);
+					else
+						++it;
+				}
+				return (size - this->_size);
 			}
 
 			/* Modifiers: Removes the element (if one exists) with the key */
@@ -201,6 +354,107 @@ namespace ft
 				return (1);
 			}
 
+			/**
+			 * Modifiers: Unlinks the element at pos and returns a handle owning its node. Nothing is copied or
+			 * allocated, except for a node of the block made by compact(), which cannot leave it: its element is
+			 * copied into a node of its own, and nothing changes if that throws
+			 */
+			node_handle_type	extract(const_iterator pos)
+			{
+				node_pointer	node = pos.node_ptr();
+				node_pointer	copy;
+
+				if (this->in_slab(node) == false)
+					return (node_handle_type(this->unlink_node(pos), this->_node_alloc, this->_value_alloc));
+				copy = this->_node_alloc.allocate(1);
+				try
+				{
+					this->_value_alloc.construct(&copy->_value, node->_value);
+				}
+				catch (...)
+				{
+					this->_node_alloc.deallocate(copy, 1);
+					throw ;
+				}
+				this->erase(pos);
+				return (node_handle_type(copy, this->_node_alloc, this->_value_alloc));
+			}
+
+			/**
+			 * Modifiers: Moves every element of other whose key is not in *this into *this. When the allocators are
+			 * equal the nodes are relinked, so nothing is copied or allocated and iterators to the moved elements
+			 * stay valid, now pointing into *this. Otherwise, and for nodes of a block made by compact(), the
+			 * element is copied and erased from other. Other is walked in order and each position is looked up
+			 * from the one before, so merging a tree of keys that fall in one gap of *this skips the descents
+			 */
+			void	merge(rbtree& other)
+			{
+				const bool		relink = (this->_node_alloc == other._node_alloc && this->_value_alloc == other._value_alloc);
+				const_iterator	it = other.begin();
+				iterator		hint = this->begin();
+
+				if (this == &other)
+					return ;
+				while (it != other.end())
+				{
+					leaf_node_pointer	parent;
+					node_pointer		temp;
+					const_iterator		pos = it++;
+					node_pointer&		child = this->get_pos_iterator(hint, parent, *pos, temp);
+
+					if (child != NULL)
+						hint = iterator(child);
+					else if (relink && other.in_slab(pos.node_ptr()) == false)
+						hint = this->link_node(child, parent, other.unlink_node(pos));
+					else
+					{
+						hint = this->insert_pos(child, parent, *pos);
+						other.erase(pos);
+					}
+					++hint;
+				}
+			}
+
+			/* Modifiers: Removes every element with the key and returns how many there were */
+			template <class Key>
+			size_type	erase_multi(const Key& key)
+			{
+				pair<iterator, iterator>	range = this->equal_range_multi(key);
+				size_type					count = static_cast<size_type>(std::distance(range.first, range.second));
+
+				this->erase(range.first, range.second);
+				return (count);
+			}
+
+			/**
+			 * Modifiers: Moves every element of other into *this, after the elements of *this with an equivalent
+			 * key, relinking or copying the nodes as merge() does
+			 */
+			void	merge_multi(rbtree& other)
+			{
+				const bool		relink = (this->_node_alloc == other._node_alloc && this->_value_alloc == other._value_alloc);
+				const_iterator	it = other.begin();
+				iterator		hint = this->begin();
+
+				if (this == &other)
+					return ;
+				while (it != other.end())
+				{
+					leaf_node_pointer	parent;
+					const_iterator		pos = it++;
+					node_pointer&		child = this->get_pos_multi(hint, parent, *pos);
+
+					if (relink && other.in_slab(pos.node_ptr()) == false)
+						hint = this->link_node(child, parent, other.unlink_node(pos));
+					else
+					{
+						hint = this->insert_pos(child, parent, *pos);
+						other.erase(pos);
+					}
+					++hint;
+				}
+			}
+
 			/* Modifiers: Swaps the contents */
 			void	swap(rbtree& other)
 			{
@@ -208,6 +462,10 @@ namespace ft
 				std::swap(this->_leaf_node, other._leaf_node);
 				std::swap(this->_size, other._size);
 				std::swap(this->_comp, other._comp);
+				std::swap(this->_slab, other._slab);
+				std::swap(this->_slab_size, other._slab_size);
+				std::swap(this->_slab_used, other._slab_used);
+				std::swap(this->_slab_free, other._slab_free);
 				if (this->size() == 0)
 					this->_leaf_node_ptr = this->end_node();
 				else
@@ -216,6 +474,50 @@ namespace ft
 					other._leaf_node_ptr = other.end_node();
 				else
 					other.end_node()->_left->_parent = other.end_node();
+# ifdef FT_THREADED_RBTREE
+				if (this->size() != 0)
+					this->end_node()->_prev->_next = this->end_node();
+				if (other.size() != 0)
+					other.end_node()->_prev->_next = other.end_node();
+# endif
+			}
+
+			/**
+			 * Modifiers: Rebuilds the tree with minimal height into one new block of nodes laid out in key order,
+			 * so scans read memory sequentially and lookups touch fewer cache lines. Takes O(n) and briefly needs
+			 * memory for two copies of the elements. The elements are copied, so every iterator, pointer and
+			 * reference to them is invalidated. Nothing changes if a copy throws. Erased nodes of the block are
+			 * reused by later inserts, and the block is freed with its last node or on the next compact()
+			 */
+			void	compact()
+			{
+				const size_type	count = this->_size;
+				node_pointer	slab;
+				size_type		built = 0;
+
+				if (count == 0)
+					return ;
+				slab = this->_node_alloc.allocate(count);
+				try
+				{
+					for (const_iterator it = this->begin(); built < count; ++it, ++built)
+						this->_value_alloc.construct(&slab[built]._value, *it);
+				}
+				catch (...)
+				{
+					while (built-- > 0)
+						this->_value_alloc.destroy(&slab[built]._value);
+					this->_node_alloc.deallocate(slab, count);
+					throw ;
+				}
+				this->clear();
+				for (size_type i = 0; i + 1 < count; i++)
+					slab[i]._right = &slab[i + 1];
+				slab[count - 1]._right = NULL;
+				this->_slab = slab;
+				this->_slab_size = count;
+				this->_slab_used = count;
+				this->link_tree(slab, count);
 			}
 
 			/* Lookup: Returns the number of elements matching specific key */
@@ -240,6 +542,37 @@ namespace ft
 				return (ptr == NULL) ? const_iterator(end_node()) : const_iterator(ptr);
 			}
 
+			/* Lookup: Finds every key in [first, last) and writes an iterator to each, or end(), to out */
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+			{
+				leaf_node_pointer	found[find_batch_size];
+				size_type			count;
+
+				while (first != last)
+				{
+					first = this->find_group(first, last, found, count);
+					for (size_type i = 0; i < count; i++, ++out)
+						*out = iterator(found[i]);
+				}
+				return (out);
+			}
+
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+			{
+				leaf_node_pointer	found[find_batch_size];
+				size_type			count;
+
+				while (first != last)
+				{
+					first = this->find_group(first, last, found, count);
+					for (size_type i = 0; i < count; i++, ++out)
+						*out = const_iterator(found[i]);
+				}
+				return (out);
+			}
+
 			/* Compares the keys to key */
 			template <class Key>
 			pair<iterator, iterator>	equal_range(const Key& key)
@@ -255,6 +588,30 @@ namespace ft
 				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
 			}
 
+			/* Lookup: Returns the range of every element with the key, in O(log n) */
+			template <class Key>
+			pair<iterator, iterator>	equal_range_multi(const Key& key)
+			{
+				pair<leaf_node_pointer, leaf_node_pointer>	range = get_equal_range_multi(key);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			}
+
+			template <class Key>
+			pair<const_iterator, const_iterator>	equal_range_multi(const Key& key) const
+			{
+				pair<leaf_node_pointer, leaf_node_pointer>	range = get_equal_range_multi(key);
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			}
+
+			/* Lookup: Returns the number of elements with the key, in O(log n + count) */
+			template <class Key>
+			size_type	count_multi(const Key& key) const
+			{
+				pair<const_iterator, const_iterator>	range = this->equal_range_multi(key);
+
+				return (static_cast<size_type>(std::distance(range.first, range.second)));
+			}
+
 			/* Lookup: Returns an iterator to the first element not less than the given key */
 			template <class Key>
 			iterator	lower_bound(const Key& key)
@@ -293,15 +650,55 @@ namespace ft
 			}
 
 		private:
-			/* Helper function: Destroys a node */
-			void	destroy(node_pointer node)
+			/* Helper function: Destroys the subtree under node and returns its size. The right child is prefetched so it arrives while the left subtree is freed */
+			size_type	destroy(node_pointer node)
 			{
+				size_type	count;
+
 				if (node == NULL)
-					return ;
-				this->destroy(node->_left);
-				this->destroy(node->_right);
+					return (0);
+				if (node->_right != NULL)
+					__builtin_prefetch(node->_right);
+				count = this->destroy(node->_left) + this->destroy(node->_right) + 1;
 				_value_alloc.destroy(&node->_value);
-				_node_alloc.deallocate(node, 1);
+				this->deallocate_node(node);
+				return (count);
+			}
+
+			/* Helper function: Returns memory for one node, taken from the compacted block while it has free slots */
+			node_pointer	allocate_node()
+			{
+				node_pointer	node = this->_slab_free;
+
+				if (node == NULL)
+					return (this->_node_alloc.allocate(1));
+				this->_slab_free = node->_right;
+				this->_slab_used++;
+				return (node);
+			}
+
+			/* Helper function: Checks whether node is a slot of the compacted block */
+			bool	in_slab(node_pointer node) const
+			{
+				return (node >= this->_slab && node < this->_slab + this->_slab_size);
+			}
+
+			/* Helper function: Frees the memory of one node. Slots of the compacted block go to its free list, and the block is freed once all are free */
+			void	deallocate_node(node_pointer node)
+			{
+				if (this->in_slab(node) == false)
+				{
+					this->_node_alloc.deallocate(node, 1);
+					return ;
+				}
+				node->_right = this->_slab_free;
+				this->_slab_free = node;
+				if (--this->_slab_used != 0)
+					return ;
+				this->_node_alloc.deallocate(this->_slab, this->_slab_size);
+				this->_slab = NULL;
+				this->_slab_size = 0;
+				this->_slab_free = NULL;
 			}
 
 			/* Helper function: Returns the end node */
@@ -344,6 +741,53 @@ namespace ft
 				return (ft::make_pair(lb, ub));
 			}
 
+			/* Helper function: Gets the lower and upper bound nodes, splitting the two searches at the first node with the key */
+			template <class Key>
+			pair<leaf_node_pointer, leaf_node_pointer>	get_equal_range_multi(const Key& key) const
+			{
+				node_pointer		ptr = this->root();
+				leaf_node_pointer	ub = this->end_node();
+				leaf_node_pointer	lb = this->end_node();
+
+				while (ptr != NULL)
+				{
+					if (value_comp()(key, ptr->_value))
+					{
+						ub = static_cast<leaf_node_pointer>(ptr);
+						lb = static_cast<leaf_node_pointer>(ptr);
+						ptr = ptr->_left;
+					}
+					else if (value_comp()(ptr->_value, key))
+						ptr = ptr->_right;
+					else
+					{
+						lb = static_cast<leaf_node_pointer>(ptr);
+						for (node_pointer node = ptr->_left; node != NULL;)
+						{
+							if (value_comp()(node->_value, key))
+								node = node->_right;
+							else
+							{
+								lb = static_cast<leaf_node_pointer>(node);
+								node = node->_left;
+							}
+						}
+						for (node_pointer node = ptr->_right; node != NULL;)
+						{
+							if (value_comp()(key, node->_value))
+							{
+								ub = static_cast<leaf_node_pointer>(node);
+								node = node->_left;
+							}
+							else
+								node = node->_right;
+						}
+						break ;
+					}
+				}
+				return (ft::make_pair(lb, ub));
+			}
+
 			/* Helper function: Get the lower bound node */
 			template <class Key>
 			leaf_node_pointer	get_lower_bound(const Key& key) const
@@ -381,6 +825,58 @@ namespace ft
 				return (NULL);
 			}
 
+			/* Number of searches find_batch runs side by side, about the number of cache misses a core keeps in flight */
+			static const size_type	find_batch_size = 8;
+
+			/**
+			 * Helper function: Searches for up to find_batch_size keys from first at once, one level of every
+			 * search per round, and prefetches the child each search goes to next. The searches do not depend on
+			 * each other, so their cache misses overlap instead of following one another. Sets found to the node
+			 * or end node of each key and count to the number of keys taken, and returns the iterator after them
+			 */
+			template <class ForwardIt>
+			ForwardIt	find_group(ForwardIt first, ForwardIt last, leaf_node_pointer *found, size_type& count) const
+			{
+				ForwardIt		keys[find_batch_size];
+				node_pointer	nodes[find_batch_size];
+				size_type		active;
+
+				for (count = 0; count < find_batch_size && first != last; ++count, ++first)
+				{
+					keys[count] = first;
+					nodes[count] = this->root();
+					found[count] = this->end_node();
+				}
+				active = count;
+				while (active != 0)
+				{
+					active = 0;
+					for (size_type i = 0; i < count; i++)
+					{
+						node_pointer	node = nodes[i];
+
+						if (node == NULL)
+							continue ;
+						if (this->value_comp()(*keys[i], node->_value))
+							node = node->_left;
+						else if (this->value_comp()(node->_value, *keys[i]))
+							node = node->_right;
+						else
+						{
+							found[i] = static_cast<leaf_node_pointer>(node);
+							node = NULL;
+						}
+						if (node != NULL)
+						{
+							__builtin_prefetch(node);
+							active++;
+						}
+						nodes[i] = node;
+					}
+				}
+				return (first);
+			}
+
 			/* Helper function: Get the position of the node based on the key */
 			template<class Key>
 			node_pointer&	get_pos_key(leaf_node_pointer& parent, const Key& key) const
@@ -426,6 +922,43 @@ namespace ft
 				return (parent->_left);
 			}
 
+			/* Helper function: Gets the empty slot after every element not greater than value, where insert_multi links a new node */
+			node_pointer&	get_pos_multi(leaf_node_pointer& parent, const value_type& value) const
+			{
+				node_pointer	*child = &this->end_node()->_left;
+
+				parent = this->end_node();
+				while (*child != NULL)
+				{
+					parent = static_cast<leaf_node_pointer>(*child);
+					if (value_comp()(value, (*child)->_value))
+						child = &(*child)->_left;
+					else
+						child = &(*child)->_right;
+				}
+				return (*child);
+			}
+
+			/* Helper function: Gets the empty slot just before pos if value is not less than the element before pos and is less than the one at pos, or else the slot found from the root */
+			node_pointer&	get_pos_multi(const_iterator pos, leaf_node_pointer& parent, const value_type& value) const
+			{
+				if (pos == this->end() || value_comp()(value, *pos))
+				{
+					const_iterator	prev = pos;
+					if (pos == this->begin() || value_comp()(value, *--prev) == false)
+					{
+						if (pos.base()->_left == NULL)
+						{
+							parent = pos.base();
+							return (parent->_left);
+						}
+						parent = prev.base();
+						return (prev.node_ptr()->_right);
+					}
+				}
+				return (this->get_pos_multi(parent, value));
+			}
+
 			/* Helper function: Get the position of the node based on the iterator */
 			template<class Key>
 			node_pointer&	get_pos_iterator(iterator it, leaf_node_pointer& parent, const Key& key, node_pointer& temp) const
@@ -495,17 +1028,496 @@ namespace ft
 			/* Helper function: Insert a new node into the pos */
 			iterator	insert_pos(node_pointer& pos, leaf_node_pointer parent, const value_type& value)
 			{
-				pos = this->_node_alloc.allocate(1);
-				pos->_left = NULL;
-				pos->_right = NULL;
-				pos->_parent = parent;
-				this->_value_alloc.construct(&pos->_value, value);
+				node_pointer	node = this->allocate_node();
+
+				try
+				{
+					this->_value_alloc.construct(&node->_value, value);
+				}
+				catch (...)
+				{
+					this->deallocate_node(node);
+					throw ;
+				}
+				return (this->link_node(pos, parent, node));
+			}
+
+			/* Helper function: Links node, which holds an element but is in no tree, into the empty slot pos under parent */
+			iterator	link_node(node_pointer& pos, leaf_node_pointer parent, node_pointer node)
+			{
+				pos = node;
+				node->_left = NULL;
+				node->_right = NULL;
+				node->_parent = parent;
 				if (this->_leaf_node_ptr->_left != NULL)
 					this->_leaf_node_ptr = this->_leaf_node_ptr->_left;
 				this->_size++;
-				node_pointer ptr = pos;
-				btree_insert(this->end_node()->_left, ptr);
-				return (iterator(ptr));
+				btree_insert(this->end_node()->_left, node);
+				return (iterator(node));
+			}
+
+			/* Helper function: Takes the node at pos out of the tree without destroying or freeing it */
+			node_pointer	unlink_node(const_iterator pos)
+			{
+				node_pointer	node = pos.node_ptr();
+
+				if (this->_leaf_node_ptr == pos.base())
+					this->_leaf_node_ptr = (++pos).base();
+				btree_delete(this->end_node()->_left, node);
+				this->_size--;
+				return (node);
+			}
+
+			/**
+			 * Helper function: Builds a subtree from the next count elements, splitting them at the middle. Every
+			 * leaf then sits at depth red_depth or red_depth - 1, so colouring the nodes at red_depth red (unless
+			 * it is the root) gives every path the same number of black nodes. Cleans up after itself if a copy throws
+			 */
+			template <class ForwardIt>
+			node_pointer	build_sorted(ForwardIt& first, size_type count, leaf_node_pointer parent, size_type depth, size_type red_depth)
+			{
+				node_pointer	node;
+
+				if (count == 0)
+					return (NULL);
+				node = this->allocate_node();
+				node->_left = NULL;
+				node->_right = NULL;
+				node->_parent = parent;
+				node->_black = (depth == 0 || depth != red_depth);
+				try
+				{
+					node->_left = this->build_sorted(first, (count - 1) / 2, node, depth + 1, red_depth);
+					this->_value_alloc.construct(&node->_value, *first);
+				}
+				catch (...)
+				{
+					this->destroy(node->_left);
+					this->deallocate_node(node);
+					throw ;
+				}
+				++first;
+				try
+				{
+					node->_right = this->build_sorted(first, count - 1 - (count - 1) / 2, node, depth + 1, red_depth);
+				}
+				catch (...)
+				{
+					this->destroy(node);
+					throw ;
+				}
+				return (node);
+			}
+
+			/* Ranges shorter than this are erased node by node, which is cheaper than splitting the tree */
+			static const size_type	erase_split_threshold = 32;
+
+			/* Helper struct: A detached tree and its black height, which split and join pass along so that no join walks a spine to find it */
+			struct	detached_tree
+			{
+				node_pointer	root;
+				size_type		height;
+
+				detached_tree(node_pointer root = NULL, size_type height = 0) : root(root), height(height) {};
+			};
+
+			/* Helper function: Erases the nodes from first up to last by splitting the tree around them and joining the rest */
+			void	erase_split(node_pointer first, leaf_node_pointer last)
+			{
+				detached_tree	left;
+				detached_tree	middle;
+				detached_tree	right;
+				size_type		count;
+
+# ifdef FT_THREADED_RBTREE
+				last->_prev = first->_prev;
+				if (first->_prev != NULL)
+					first->_prev->_next = last;
+# endif
+				if (this->_leaf_node_ptr == first)
+					this->_leaf_node_ptr = last;
+				this->detach(this->root());
+				this->split_tree(detached_tree(this->root(), this->black_height(this->root())), first, left, middle);
+				if (last == this->end_node())
+				{
+					count = this->destroy(middle.root);
+					this->end_node()->_left = left.root;
+				}
+				else
+				{
+					node_pointer	last_node = static_cast<node_pointer>(last);
+
+					this->split_tree(middle, last_node, middle, right);
+					count = this->destroy(middle.root);
+					this->end_node()->_left = this->join_trees(left, last_node, right).root;
+				}
+				if (this->root() != NULL)
+					this->root()->_parent = this->end_node();
+				this->_value_alloc.destroy(&first->_value);
+				this->deallocate_node(first);
+				this->_size -= count + 1;
+			}
+
+			/* Helper function: Makes node the root of a tree of its own, coloured black as every root is */
+			static void	detach(node_pointer node)
+			{
+				if (node == NULL)
+					return ;
+				node->_parent = NULL;
+				node->_black = true;
+			}
+
+			/* Helper function: Returns the number of black nodes on a path from node down to a leaf */
+			static size_type	black_height(node_pointer node)
+			{
+				size_type	height = 0;
+
+				for (; node != NULL; node = node->_left)
+					height += node->_black;
+				return (height);
+			}
+
+			/**
+			 * Helper function: Splits the detached tree at target, which must be in it. Left and right become
+			 * detached trees of the nodes before and after target. The way down is read from the parent links
+			 * rather than found by comparing values, so equal keys split at the right node
+			 */
+			void	split_tree(detached_tree tree, node_pointer target, detached_tree& left, detached_tree& right)
+			{
+				bool		path[2 * sizeof(size_type) * CHAR_BIT + 1];
+				size_type	depth = 0;
+
+				for (node_pointer node = target; node != tree.root; node = node->get_parent_ptr())
+					path[depth++] = (node->get_parent_ptr()->_right == node);
+				this->split_path(tree, path, depth, left, right);
+			}
+
+			/**
+			 * Helper function: Splits the detached tree at the end of the path, whose last entry says which child
+			 * of its root to go down to. Each level joins what it cuts off to one side, and as the black heights of
+			 * the joined trees only grow, the joins along the path add up to O(log n). The black height of a child
+			 * is the one of its parent less the parent's own black, plus one if detaching turns the child black
+			 */
+			void	split_path(detached_tree tree, const bool *path, size_type depth, detached_tree& left, detached_tree& right)
+			{
+				node_pointer		node = tree.root;
+				const size_type		height = tree.height - node->_black;
+				const detached_tree	lchild(node->_left, height + (node_is_black(node->_left) == false));
+				const detached_tree	rchild(node->_right, height + (node_is_black(node->_right) == false));
+
+				this->detach(lchild.root);
+				this->detach(rchild.root);
+				if (depth == 0)
+				{
+					left = lchild;
+					right = rchild;
+				}
+				else if (path[depth - 1] == false)
+				{
+					this->split_path(lchild, path, depth - 1, left, right);
+					right = this->join_trees(right, node, rchild);
+				}
+				else
+				{
+					this->split_path(rchild, path, depth - 1, left, right);
+					left = this->join_trees(lchild, node, left);
+				}
+			}
+
+			/**
+			 * Helper function: Joins the detached trees left and right, whose values are all smaller and greater
+			 * than node's, with node between them and returns the detached root. Node goes red down the inner spine
+			 * of the taller tree to the first black node of the other tree's black height, takes that subtree and
+			 * the other tree as children, and is then repaired like an insertion. The repair never turns the root
+			 * red, so node keeps the shorter black height plus its own black below it, and the new black height is
+			 * that plus the black nodes above it. Takes O(difference in height + 1)
+			 */
+			detached_tree	join_trees(detached_tree left, node_pointer node, detached_tree right)
+			{
+				leaf_node_type		header;
+				leaf_node_pointer	parent = &header;
+				node_pointer		spine;
+				size_type			height;
+
+				if (left.height == right.height)
+				{
+					node->_left = left.root;
+					node->_right = right.root;
+				}
+				else if (left.height > right.height)
+				{
+					for (spine = left.root, height = left.height; node_is_black(spine) == false || height != right.height; spine = spine->_right)
+					{
+						height -= spine->_black;
+						parent = static_cast<leaf_node_pointer>(spine);
+					}
+					node->_left = spine;
+					node->_right = right.root;
+					static_cast<node_pointer>(parent)->_right = node;
+					header._left = left.root;
+				}
+				else
+				{
+					for (spine = right.root, height = right.height; node_is_black(spine) == false || height != left.height; spine = spine->_left)
+					{
+						height -= spine->_black;
+						parent = static_cast<leaf_node_pointer>(spine);
+					}
+					node->_left = left.root;
+					node->_right = spine;
+					parent->_left = node;
+					header._left = right.root;
+				}
+				if (header._left == NULL)
+					header._left = node;
+				header._left->_parent = &header;
+				node->_parent = parent;
+				if (node->_left != NULL)
+					node->_left->set_parent_ptr(node);
+				if (node->_right != NULL)
+					node->_right->set_parent_ptr(node);
+				btree_insert_fixup(header._left, node);
+				height = std::min(left.height, right.height) + node->_black;
+				for (spine = node; spine != header._left; height += spine->_black)
+					spine = spine->get_parent_ptr();
+				header._left->_parent = NULL;
+				return (detached_tree(header._left, height));
+			}
+
+			/* Number of elements erase_if looks at before it may switch to rebuilding */
+			static const size_type	erase_if_sample = 64;
+
+			/**
+			 * Helper struct: State of the in-order walk of unlink_nodes, kept outside it so the walk can resume
+			 * after pred throws. The kept nodes after the first one are built into a tree as they come, like a
+			 * binary counter: perfect[h] is a perfect all-black tree of height h + 1 waiting for the node after
+			 * it, middle[h] is that node once it came, and the next perfect tree of the same height makes them
+			 * one of height h + 2
+			 */
+			struct	unlink_state
+			{
+				node_pointer	node;
+				node_pointer	stack[2 * sizeof(size_type) * CHAR_BIT + 1];
+				size_type		depth;
+				node_pointer	first_kept;
+				node_pointer	last_kept;
+				node_pointer	perfect[sizeof(size_type) * CHAR_BIT];
+				node_pointer	middle[sizeof(size_type) * CHAR_BIT];
+				size_type		removed;
+
+				unlink_state(node_pointer root, node_pointer prev) : node(root), depth(0), first_kept(NULL), last_kept(prev), removed(0)
+				{
+					for (size_type h = 0; h < sizeof(size_type) * CHAR_BIT; h++)
+					{
+						this->perfect[h] = NULL;
+						this->middle[h] = NULL;
+					}
+				};
+			};
+
+			/**
+			 * Helper function: Runs the rest of erase_if from first. Splits the tree before first, frees the matches
+			 * among first and the nodes after it while building a tree of the others, and joins the two trees.
+			 * If pred throws, the walk goes on keeping every node, the tree is put back together, and the exception
+			 * is rethrown
+			 */
+			template <class Predicate>
+			void	erase_rebuild(node_pointer first, Predicate& pred)
+			{
+				detached_tree	left;
+				detached_tree	right;
+# ifdef FT_THREADED_RBTREE
+				unlink_state	state(first, first->_prev);
+# else
+				unlink_state	state(first, NULL);
+# endif
+
+				this->detach(this->root());
+				this->split_tree(detached_tree(this->root(), this->black_height(this->root())), first, left, right);
+				first->_left = NULL;
+				first->_right = right.root;
+				try
+				{
+					this->unlink_nodes(state, &pred);
+				}
+				catch (...)
+				{
+					state.node = NULL;
+					this->unlink_nodes(state, static_cast<Predicate *>(NULL));
+					this->join_kept(left, state);
+					throw ;
+				}
+				this->join_kept(left, state);
+			}
+
+			/**
+			 * Helper function: Walks in order from where state stopped, freeing the nodes pred selects and adding
+			 * the others to the tree in state. A node stays on the stack until pred has returned for it, and its
+			 * links are read before it is freed or relinked, so the walk never goes through a node it has already
+			 * changed. A NULL pred keeps every node
+			 */
+			template <class Predicate>
+			void	unlink_nodes(unlink_state& state, Predicate *pred)
+			{
+				node_pointer	node;
+				bool			matched;
+
+				for (;;)
+				{
+					for (; state.node != NULL; state.node = state.node->_left)
+					{
+						if (state.node->_right != NULL)
+							__builtin_prefetch(state.node->_right);
+						state.stack[state.depth++] = state.node;
+					}
+					if (state.depth == 0)
+						return ;
+					node = state.stack[state.depth - 1];
+					matched = (pred != NULL && (*pred)(node->_value));
+					state.depth--;
+					state.node = node->_right;
+					if (matched)
+					{
+						this->_value_alloc.destroy(&node->_value);
+						this->deallocate_node(node);
+						state.removed++;
+						continue ;
+					}
+# ifdef FT_THREADED_RBTREE
+					node->_prev = state.last_kept;
+					if (state.last_kept != NULL)
+						state.last_kept->_next = node;
+# endif
+					state.last_kept = node;
+					if (state.first_kept == NULL)
+						state.first_kept = node;
+					else
+						this->add_kept(state, node);
+				}
+			}
+
+			/* Helper function: Adds node, which follows every node added before, to the tree of kept nodes in state */
+			static void	add_kept(unlink_state& state, node_pointer node)
+			{
+				size_type	h = 0;
+
+				while (h + 1 < sizeof(size_type) * CHAR_BIT && state.perfect[h] == NULL)
+					h++;
+				if (state.perfect[h] != NULL && state.middle[h] == NULL)
+				{
+					state.middle[h] = node;
+					return ;
+				}
+				node->_left = NULL;
+				node->_right = NULL;
+				node->_black = true;
+				for (h = 0; state.middle[h] != NULL; h++)
+				{
+					node_pointer	middle = state.middle[h];
+
+					middle->_left = state.perfect[h];
+					middle->_right = node;
+					middle->_black = true;
+					middle->_left->set_parent_ptr(middle);
+					node->set_parent_ptr(middle);
+					state.perfect[h] = NULL;
+					state.middle[h] = NULL;
+					node = middle;
+				}
+				state.perfect[h] = node;
+			}
+
+			/* Helper function: Joins the detached tree left with the tree of nodes state kept and makes it the whole tree */
+			void	join_kept(detached_tree left, unlink_state& state)
+			{
+				node_pointer	root = left.root;
+
+				if (state.first_kept != NULL)
+				{
+					detached_tree	right;
+
+					for (size_type h = 0; h < sizeof(size_type) * CHAR_BIT; h++)
+					{
+						if (state.perfect[h] == NULL)
+							continue ;
+						state.perfect[h]->_parent = NULL;
+						if (state.middle[h] == NULL)
+							right = detached_tree(state.perfect[h], h + 1);
+						else
+							right = this->join_trees(detached_tree(state.perfect[h], h + 1), state.middle[h], right);
+					}
+					root = this->join_trees(left, state.first_kept, right).root;
+				}
+				this->end_node()->_left = root;
+				if (root != NULL)
+					root->_parent = this->end_node();
+				this->_leaf_node_ptr = (root == NULL ? this->end_node() : static_cast<leaf_node_pointer>(most_left_node(root)));
+				this->_size -= state.removed;
+# ifdef FT_THREADED_RBTREE
+				this->end_node()->_prev = state.last_kept;
+				if (state.last_kept != NULL)
+					state.last_kept->_next = this->end_node();
+# endif
+			}
+
+			/* Helper function: Makes the count nodes of the list at head, linked in order through _right, the whole tree */
+			void	link_tree(node_pointer head, size_type count)
+			{
+				size_type	red_depth = 0;
+
+				while ((count >> (red_depth + 1)) != 0)
+					red_depth++;
+				this->_leaf_node = leaf_node_type();
+				this->end_node()->_left = this->link_list(head, count, 0, red_depth);
+				if (this->root() != NULL)
+					this->root()->_parent = this->end_node();
+				this->_leaf_node_ptr = (count == 0 ? this->end_node() : most_left_node(this->root()));
+				this->_size = count;
+				this->thread_nodes();
+			}
+
+			/* Helper function: Links the next count nodes of the list at head into a subtree the same shape and colours as build_sorted's, and advances head past them */
+			node_pointer	link_list(node_pointer& head, size_type count, size_type depth, size_type red_depth)
+			{
+				node_pointer	left;
+				node_pointer	node;
+
+				if (count == 0)
+					return (NULL);
+				left = this->link_list(head, (count - 1) / 2, depth + 1, red_depth);
+				node = head;
+				head = head->_right;
+				node->_left = left;
+				if (left != NULL)
+					left->set_parent_ptr(node);
+				node->_black = (depth == 0 || depth != red_depth);
+				node->_right = this->link_list(head, count - 1 - (count - 1) / 2, depth + 1, red_depth);
+				if (node->_right != NULL)
+					node->_right->set_parent_ptr(node);
+				return (node);
+			}
+
+			/* Helper function: Links every node to its in-order neighbours, for trees built without btree_insert */
+			void	thread_nodes()
+			{
+# ifdef FT_THREADED_RBTREE
+				node_pointer		prev = NULL;
+				leaf_node_pointer	pos = this->_leaf_node_ptr;
+
+				while (pos != this->end_node())
+				{
+					node_pointer	node = static_cast<node_pointer>(pos);
+
+					node->_prev = prev;
+					if (prev != NULL)
+						prev->_next = pos;
+					prev = node;
+					pos = iter_to_next<leaf_node_pointer>(node);
+				}
+				this->end_node()->_prev = prev;
+				if (prev != NULL)
+					prev->_next = this->end_node();
+# endif
 			}
 
 			/* Helper function: Returns the root node */
@@ -521,7 +1533,12 @@ namespace ft
 			leaf_node_type		_leaf_node;
 			leaf_node_pointer	_leaf_node_ptr;
 			size_type			_size;
+			node_pointer		_slab;
+			size_type			_slab_size;
+			size_type			_slab_used;
+			node_pointer		_slab_free;
 	};
+	}
 }
 
 #endif
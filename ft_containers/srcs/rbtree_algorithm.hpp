@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/14 13:24:10 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/20 17:32:54 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 01:37:52 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -83,6 +83,45 @@ namespace ft
 		return (node->_parent);
 	}
 
+# ifdef FT_THREADED_RBTREE
+	/* Links a node that was just attached as a leaf between its in-order neighbours */
+	template <class T>
+	void	node_link_thread(rbt_node<T> *node)
+	{
+		typename rbt_node<T>::leaf_node_pointer	next;
+
+		if (node_is_left_child(node))
+			next = node->_parent;
+		else
+			next = node->get_parent_ptr()->_next;
+		node->_next = next;
+		node->_prev = next->_prev;
+		if (node->_prev != NULL)
+			node->_prev->_next = node;
+		next->_prev = node;
+	}
+
+	/* Unlinks a node from its in-order neighbours */
+	template <class T>
+	void	node_unlink_thread(rbt_node<T> *node)
+	{
+		node->_next->_prev = node->_prev;
+		if (node->_prev != NULL)
+			node->_prev->_next = node->_next;
+	}
+# endif
+
+	/* Nodes without threads have nothing to link */
+	template <class Node>
+	void	node_link_thread(Node)
+	{
+	}
+
+	template <class Node>
+	void	node_unlink_thread(Node)
+	{
+	}
+
 	/* Rotates a node to the left */
 	template <class Node>
 	void	node_rotate_left(Node node)
@@ -186,7 +225,7 @@ namespace ft
 	 * 		4. All cases apply when the condition is mirrored
 	 */
 	template <class Node>
-	void	btree_insert(Node root, Node z)
+	void	btree_insert_fixup(Node root, Node z)
 	{
 		/* Case 1 */
 		z->_black = (z == root);
@@ -257,6 +296,15 @@ namespace ft
 		}
 	}
 	
+	/* Inserts z, a red leaf already linked under its parent, and fixes the tree with btree_insert_fixup */
+	template <class Node>
+	void	btree_insert(Node root, Node z)
+	{
+		/* Rotations keep the in-order sequence, so the threads only change here */
+		node_link_thread(z);
+		btree_insert_fixup(root, z);
+	}
+
 	/**
 	 * Deletion strategy:
 	 *	1. Find the node to be deleted using binary search tree traversal
@@ -436,6 +484,8 @@ namespace ft
 		Node	rchild;
 		bool	removed;
 
+		node_unlink_thread(remove);
+
 		/* If remove has 2 non-null children, replace it with its inorder successor */
 		if (lchild->_left != NULL && lchild->_right != NULL)
 			lchild = most_left_node(remove->_right);
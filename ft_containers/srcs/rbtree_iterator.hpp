@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/16 13:06:52 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/20 17:32:52 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 12:58:26 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,8 @@
 
 namespace ft
 {
+	namespace FT_RBTREE_NAMESPACE
+	{
 	/* Const tree iterator definition */
 	template <class Key, class T>
 	class const_tree_iterator;
@@ -89,7 +91,11 @@ namespace ft
 			/* Advances of decrements the iterator */
 			tree_iterator&	operator++()
 			{
+# ifdef FT_THREADED_RBTREE
+				ptr = static_cast<node_pointer>(this->ptr)->_next;
+# else
 				ptr = iter_to_next<leaf_node_pointer>(static_cast<node_pointer>(this->ptr));
+# endif
 				return (*this);
 			};
 
@@ -102,7 +108,11 @@ namespace ft
 
 			tree_iterator&	operator--()
 			{
+# ifdef FT_THREADED_RBTREE
+				ptr = this->ptr->_prev;
+# else
 				ptr = iter_to_prev<node_pointer>(this->ptr);
+# endif
 				return (*this);
 			};
 
@@ -202,7 +212,11 @@ namespace ft
 			/* Advances of decrements the iterator */
 			const_tree_iterator&	operator++()
 			{
+# ifdef FT_THREADED_RBTREE
+				ptr = static_cast<node_pointer>(this->ptr)->_next;
+# else
 				ptr = iter_to_next<leaf_node_pointer>(static_cast<node_pointer>(this->ptr));
+# endif
 				return (*this);
 			};
 
@@ -215,7 +229,11 @@ namespace ft
 
 			const_tree_iterator&	operator--()
 			{
+# ifdef FT_THREADED_RBTREE
+				ptr = this->ptr->_prev;
+# else
 				ptr = iter_to_prev<node_pointer>(ptr);
+# endif
 				return (*this);
 			};
 
@@ -251,6 +269,7 @@ namespace ft
 			/* Member object */
 			leaf_node_pointer	ptr;
 	};
+	}
 }
 
 #endif
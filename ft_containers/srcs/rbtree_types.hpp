@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/12 19:05:32 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/20 17:46:30 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 12:58:19 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,26 @@
 # include "utility.hpp"
 # include "algorithm.hpp"
 
+/**
+ * Building with FT_THREADED_RBTREE threads the nodes: every node also keeps
+ * its in-order successor in _next and its predecessor in _prev, and the end
+ * node keeps the last node in _prev. Iterators then step with one pointer
+ * load instead of climbing parents, at the cost of two pointers per node.
+ *
+ * As this changes the layout of the nodes, the trees, their iterators and node handles and the containers built on
+ * them live in a nested namespace named after the build, brought into ft by using declarations. Objects built with
+ * and without the macro then mangle ft::map and friends differently and cannot share one definition of them
+ */
+# ifdef FT_THREADED_RBTREE
+#  define FT_RBTREE_NAMESPACE	threaded_rbtree
+# else
+#  define FT_RBTREE_NAMESPACE	plain_rbtree
+# endif
+
 namespace ft
 {
+	namespace FT_RBTREE_NAMESPACE
+	{
 	/* Definitions */
 	template <class T> class	rbt_leaf_node;
 	template <class T> class	rbt_node;
@@ -42,16 +60,27 @@ namespace ft
 
             /* Public member objects */
 			node_pointer	_left;
+# ifdef FT_THREADED_RBTREE
+			node_pointer	_prev;
+# endif
 
 			/* Orthodox canonical form */
+# ifdef FT_THREADED_RBTREE
+			rbt_leaf_node() : _left(NULL), _prev(NULL) {};
+			rbt_leaf_node(const rbt_leaf_node& other) : _left(other._left), _prev(other._prev) {};
+# else
 			rbt_leaf_node() : _left(NULL) {};
 			rbt_leaf_node(const rbt_leaf_node& other) : _left(other._left) {};
+# endif
 			~rbt_leaf_node() {};
 			rbt_leaf_node&	operator=(const rbt_leaf_node& other)
 			{
 				if (this == &other)
 					return (*this);
 				this->_left = other._left;
+# ifdef FT_THREADED_RBTREE
+				this->_prev = other._prev;
+# endif
 				return (*this);
 			};
 	};
@@ -69,12 +98,20 @@ namespace ft
             /* Public member objects */
 			node_pointer		_right;
 			leaf_node_pointer	_parent;
+# ifdef FT_THREADED_RBTREE
+			leaf_node_pointer	_next;
+# endif
 			bool				_black;
 			T					_value;
 
 			/* Orthodox canonical form */
+# ifdef FT_THREADED_RBTREE
+			rbt_node() : _right(NULL), _parent(NULL), _next(NULL), _black(false), _value(NULL) {};
+			rbt_node(const rbt_node& other) : _right(other._right), _parent(other._parent), _next(other._next), _black(other._black), _value(other._value) {};
+# else
 			rbt_node() : _right(NULL), _parent(NULL), _black(false), _value(NULL) {};
 			rbt_node(const rbt_node& other) : _right(other._right), _parent(other._parent), _black(other._black), _value(other._value) {};
+# endif
 			~rbt_node() {};
 			rbt_node&	operator=(const rbt_node& other)
 			{
@@ -82,6 +119,9 @@ namespace ft
 					return (*this);
 				this->_right = other._right;
 				this->_parent = other._parent;
+# ifdef FT_THREADED_RBTREE
+				this->_next = other._next;
+# endif
 				this->_black = other._black;
 				this->_value = other._value;
 				return (*this);
@@ -91,6 +131,8 @@ namespace ft
 			node_pointer	get_parent_ptr() const { return (static_cast<node_pointer>(this->_parent)); };
 			void	set_parent_ptr(node_pointer parent) { this->_parent = static_cast<leaf_node_pointer>(parent); };
 	};
+	}
+	using namespace FT_RBTREE_NAMESPACE;
 }
 
 #endif
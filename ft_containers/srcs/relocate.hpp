@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   relocate.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:26:40 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 13:21:44 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RELOCATE_HPP
+# define RELOCATE_HPP
+
+# include <cstddef>
+# include <cstring>
+# ifdef FT_PARALLEL_RELOCATION
+#  include <pthread.h>
+#  include <unistd.h>
+# endif
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
+
+/**
+ * https://man7.org/linux/man-pages/man7/numa.7.html
+ * https://en.cppreference.com/w/cpp/string/byte/memcpy
+ * https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_stream_si128
+ *
+ * Bulk byte copies used when a vector moves its elements into a new buffer.
+ * Building with FT_PARALLEL_RELOCATION splits copies above a threshold across
+ * several threads. Each thread is the first to write its share of the fresh
+ * buffer, so on NUMA machines the pages are placed on the node of the core
+ * that touched them.
+ *
+ * Writes of at least streaming_threshold bytes use non-temporal stores where
+ * SSE2 is available. They go straight to memory instead of evicting the
+ * caller's working set for data that will not be read again soon. The
+ * threshold is off by default.
+ *
+ * The macro changes the bodies of these inline functions, so they live in a
+ * namespace named after it, brought into ft by a using directive. Objects
+ * built with and without it keep their own policy and copy routines instead
+ * of the linker keeping one body for both. Vector code shared between such
+ * objects may still call either routine, which copies the same bytes
+ */
+# ifdef FT_PARALLEL_RELOCATION
+#  define FT_RELOCATION_NAMESPACE	parallel_relocation
+# else
+#  define FT_RELOCATION_NAMESPACE	serial_relocation
+# endif
+
+namespace ft
+{
+	namespace FT_RELOCATION_NAMESPACE
+	{
+	/* Tunables for large relocations, read on every copy */
+	struct	relocation_policy
+	{
+		std::size_t	parallel_threshold;
+		std::size_t	threads;
+		std::size_t	streaming_threshold;
+	};
+
+	/* Returns the process-wide relocation policy */
+	inline relocation_policy&	relocation_settings()
+	{
+# ifdef FT_PARALLEL_RELOCATION
+		static const long			cores = sysconf(_SC_NPROCESSORS_ONLN);
+		static relocation_policy	settings = { std::size_t(64) << 20, cores > 1 ? static_cast<std::size_t>(cores) : 1, std::size_t(-1) };
+# else
+		static relocation_policy	settings = { std::size_t(64) << 20, 1, std::size_t(-1) };
+# endif
+		return (settings);
+	}
+
+	/* Returns true when a write of bytes should bypass the cache */
+	inline bool	should_stream(std::size_t bytes)
+	{
+# ifdef __SSE2__
+		return (bytes >= relocation_settings().streaming_threshold);
+# else
+		(void)bytes;
+		return (false);
+# endif
+	}
+
+	/* Copies bytes with non-temporal stores. The caller issues the fence that orders them */
+	inline void	stream_bytes(void *dst, const void *src, std::size_t bytes)
+	{
+# ifdef __SSE2__
+		char				*out = static_cast<char *>(dst);
+		const char			*in = static_cast<const char *>(src);
+		const std::size_t	head = (16 - reinterpret_cast<std::size_t>(out) % 16) % 16;
+
+		if (bytes < head + 16)
+		{
+			std::memcpy(out, in, bytes);
+			return ;
+		}
+		std::memcpy(out, in, head);
+		out += head;
+		in += head;
+		bytes -= head;
+		for (; bytes >= 64; out += 64, in += 64, bytes -= 64)
+		{
+			_mm_stream_si128(reinterpret_cast<__m128i *>(out), _mm_loadu_si128(reinterpret_cast<const __m128i *>(in)));
+			_mm_stream_si128(reinterpret_cast<__m128i *>(out + 16), _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)));
+			_mm_stream_si128(reinterpret_cast<__m128i *>(out + 32), _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 32)));
+			_mm_stream_si128(reinterpret_cast<__m128i *>(out + 48), _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 48)));
+		}
+		for (; bytes >= 16; out += 16, in += 16, bytes -= 16)
+			_mm_stream_si128(reinterpret_cast<__m128i *>(out), _mm_loadu_si128(reinterpret_cast<const __m128i *>(in)));
+		std::memcpy(out, in, bytes);
+# else
+		std::memcpy(dst, src, bytes);
+# endif
+	}
+
+	/* Orders the non-temporal stores issued so far before any later store */
+	inline void	stream_fence()
+	{
+# ifdef __SSE2__
+		_mm_sfence();
+# endif
+	}
+
+	/* Writes count copies of the size bytes at value to dst with non-temporal stores */
+	inline void	stream_fill(void *dst, const void *value, std::size_t size, std::size_t count)
+	{
+		char	*out = static_cast<char *>(dst);
+
+		for (; count > 0; count--, out += size)
+			stream_bytes(out, value, size);
+		stream_fence();
+	}
+
+	/* One share of a relocation */
+	struct	relocation_chunk
+	{
+		char		*dst;
+		const char	*src;
+		std::size_t	bytes;
+		bool		stream;
+	};
+
+	/* Copies one chunk, possibly on a worker thread */
+	inline void	*relocate_chunk(void *arg)
+	{
+		relocation_chunk	*chunk = static_cast<relocation_chunk *>(arg);
+
+		if (chunk->stream)
+		{
+			stream_bytes(chunk->dst, chunk->src, chunk->bytes);
+			stream_fence();
+		}
+		else
+			std::memcpy(chunk->dst, chunk->src, chunk->bytes);
+		return (NULL);
+	}
+
+	/* Copies bytes from src to the non-overlapping dst, in parallel and bypassing the cache when the policy allows it */
+	inline void	relocate_bytes(void *dst, const void *src, std::size_t bytes)
+	{
+		relocation_chunk	whole = { static_cast<char *>(dst), static_cast<const char *>(src), bytes, should_stream(bytes) };
+
+# ifdef FT_PARALLEL_RELOCATION
+		const relocation_policy&	settings = relocation_settings();
+		static const std::size_t	max_threads = 64;
+		static const std::size_t	page_size = 4096;
+		std::size_t					threads = settings.threads < max_threads ? settings.threads : max_threads;
+		std::size_t					share;
+		relocation_chunk			chunks[max_threads];
+		pthread_t					workers[max_threads];
+		bool						started[max_threads];
+
+		if (bytes >= settings.parallel_threshold && threads > 1)
+		{
+			share = (bytes / threads + page_size - 1) / page_size * page_size;
+			for (std::size_t i = 0; i < threads; i++)
+			{
+				const std::size_t	offset = i * share < bytes ? i * share : bytes;
+
+				chunks[i].dst = static_cast<char *>(dst) + offset;
+				chunks[i].src = static_cast<const char *>(src) + offset;
+				chunks[i].bytes = bytes - offset < share ? bytes - offset : share;
+				chunks[i].stream = whole.stream;
+			}
+			for (std::size_t i = 1; i < threads; i++)
+				started[i] = pthread_create(&workers[i], NULL, relocate_chunk, &chunks[i]) == 0;
+			relocate_chunk(&chunks[0]);
+			for (std::size_t i = 1; i < threads; i++)
+			{
+				if (started[i])
+					pthread_join(workers[i], NULL);
+				else
+					relocate_chunk(&chunks[i]);
+			}
+			return ;
+		}
+# endif
+		relocate_chunk(&whole);
+	}
+	}
+	using namespace FT_RELOCATION_NAMESPACE;
+}
+
+#endif
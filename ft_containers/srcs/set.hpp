@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/15 12:37:47 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/21 14:52:26 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 13:14:51 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,12 +16,15 @@
 # include <memory>
 # include "iterator.hpp"
 # include "rbtree.hpp"
+# include "frozen_set.hpp"
 
 /**
  * https://en.cppreference.com/w/cpp/container/set
  */
 namespace ft
 {
+	namespace FT_RBTREE_NAMESPACE
+	{
 	/* Set class 	*/
 	template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
 	class set
@@ -50,6 +53,8 @@ namespace ft
 			typedef typename base::const_iterator					const_iterator;
 			typedef ft::reverse_iterator<iterator>					reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef set_node_handle<Key, Allocator>					node_type;
+			typedef node_insert_return<iterator, node_type>			insert_return_type;
 
 			/* Default constructor */
 			set() : _rbtree(value_compare()) {};
@@ -64,6 +69,13 @@ namespace ft
 				this->insert(first, last);
 			}
 
+			/* Constructs the container from the range [first, last), which must be sorted by comp and hold no equivalent keys. Takes O(n) */
+			template <class ForwardIt>
+			set(sorted_unique_t, ForwardIt first, ForwardIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _rbtree(comp, alloc)
+			{
+				this->_rbtree.assign_sorted(first, last);
+			}
+
 			/* Copy constructor */
 			set(const set& other) : _rbtree(other._rbtree) {};
 		
@@ -165,6 +177,24 @@ namespace ft
 				return (this->_rbtree.insert(pos, value));
 			}
 
+			/* Modifiers: Inserts the node owned by nh. If an element with an equivalent key is already there, the node is handed back in the result */
+			insert_return_type	insert(node_type nh)
+			{
+				insert_return_type		result;
+				pair<iterator, bool>	inserted = this->_rbtree.insert(nh);
+
+				result.position = inserted.first;
+				result.inserted = inserted.second;
+				result.node = nh;
+				return (result);
+			}
+
+			/* Modifiers: Inserts the node owned by nh in the position as close as possible to the position just prior to pos. If an element with an equivalent key is already there, nh keeps the node. nh may be a temporary, such as the result of extract() */
+			iterator	insert(iterator pos, const node_type& nh)
+			{
+				return (this->_rbtree.insert(pos, nh));
+			}
+
 			/* Modifiers: Inserts elements from range [first, last) */
 			template <class InputIt>
 			void	insert(InputIt first, InputIt last)
@@ -190,12 +220,47 @@ namespace ft
 				return (this->_rbtree.erase(key));
 			}
 			
+			/* Modifiers: Removes every element for which pred returns true in one in-order pass and returns how many were removed. Once more than rebuild_fraction of the elements seen were removed, the rest of the tree is rebuilt in O(n) */
+			template <class Predicate>
+			size_type	erase_if(Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+			{
+				return (this->_rbtree.erase_if(pred, rebuild_fraction));
+			}
+
+			/* Modifiers: Unlinks the element at pos and returns a node handle owning it, without copying it */
+			node_type	extract(iterator pos)
+			{
+				return (node_type(this->_rbtree.extract(pos)));
+			}
+
+			/* Modifiers: Unlinks the element with the key, if there is one, and returns a node handle owning it */
+			node_type	extract(const key_type& key)
+			{
+				iterator	it = this->find(key);
+
+				if (it == this->end())
+					return (node_type());
+				return (this->extract(it));
+			}
+
+			/* Modifiers: Moves the elements of source whose key is not in *this into *this, relinking their nodes without copying them when the allocators are equal */
+			void	merge(set& source)
+			{
+				this->_rbtree.merge(source._rbtree);
+			}
+
 			/* Modifiers: Swaps the contents */
 			void	swap(set& other)
 			{
 				this->_rbtree.swap(other._rbtree);
 			}
 
+			/* Modifiers: Rebuilds the tree into one block of nodes in key order with minimal height. Invalidates all iterators, pointers and references */
+			void	compact()
+			{
+				this->_rbtree.compact();
+			}
+
 			/* Lookup: Returns the number of elements matching specific key */
 			size_type	count(const key_type& key) const
 			{
@@ -213,6 +278,19 @@ namespace ft
 				return (this->_rbtree.find(key));
 			}
 
+			/* Lookup: Finds every key in [keys_first, keys_last) and writes an iterator to each, or end(), to out. Faster than calling find() in a loop on large trees */
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt keys_first, ForwardIt keys_last, OutputIt out)
+			{
+				return (this->_rbtree.find_batch(keys_first, keys_last, out));
+			}
+
+			template <class ForwardIt, class OutputIt>
+			OutputIt	find_batch(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) const
+			{
+				return (this->_rbtree.find_batch(keys_first, keys_last, out));
+			}
+
 			/* Lookup: Returns range of elements matching a specific key */
 			pair<iterator, iterator>	equal_range(const key_type& key)
 			{
@@ -258,6 +336,12 @@ namespace ft
 				return (this->_rbtree.value_comp());
 			}
 
+			/* Returns a read-only copy laid out for fast lookups, once the set will no longer change */
+			frozen_set<Key, Compare, Allocator>	freeze() const
+			{
+				return (frozen_set<Key, Compare, Allocator>(this->begin(), this->end(), this->key_comp(), this->get_allocator()));
+			}
+
 		private:
 			base	_rbtree;
 	};
@@ -299,12 +383,22 @@ namespace ft
 		return (!(lhs < rhs));
 	}
 
+	/* Removes every element for which pred returns true and returns how many were removed */
+	template <class Key, class Compare, class Alloc, class Predicate>
+	typename set<Key, Compare, Alloc>::size_type	erase_if(set<Key, Compare, Alloc>& c, Predicate pred, double rebuild_fraction = erase_if_rebuild_fraction)
+	{
+		return (c.erase_if(pred, rebuild_fraction));
+	}
+
 	/* Swaps the contents of lhs and rhs */
 	template <class Key, class Compare, class Alloc>
 	void	swap(set<Key, Compare, Alloc>& lhs, set<Key, Compare, Alloc>& rhs)
 	{
 		lhs.swap(rhs);
 	}
+	}
+	using FT_RBTREE_NAMESPACE::swap;
+	using FT_RBTREE_NAMESPACE::erase_if;
 }
 
 #endif
@@ -0,0 +1,558 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:03:52 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 12:03:52 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SMALL_VECTOR_HPP
+# define SMALL_VECTOR_HPP
+
+# include <memory>
+# include <limits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "vector.hpp"
+
+/**
+ * https://llvm.org/docs/ProgrammersManual.html#llvm-adt-smallvector-h
+ *
+ * Vector that keeps up to N elements inside the object itself and only
+ * allocates from the heap once it grows past N. Elements are contiguous in
+ * both cases, so the interface and iterators are those of ft::vector. The
+ * inline buffer is aligned for every fundamental type; element types needing
+ * a stricter alignment must not be used
+ */
+namespace ft
+{
+	/* Small_vector class */
+	template <typename T, std::size_t N, typename Allocator = std::allocator<T> >
+	class small_vector
+	{
+		public:
+			/* Member types */
+			typedef T											value_type;
+			typedef Allocator									allocator_type;
+			typedef std::size_t									size_type;
+			typedef std::ptrdiff_t								difference_type;
+			typedef value_type&									reference;
+			typedef const value_type&							const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef vector_iterator<pointer, small_vector>		iterator;
+			typedef vector_iterator<const_pointer, small_vector>	const_iterator;
+			typedef	ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+			/* Default constructor */
+			small_vector() : _alloc(allocator_type())
+			{
+				this->reset_to_inline();
+			};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	small_vector(const allocator_type& alloc) : _alloc(alloc)
+			{
+				this->reset_to_inline();
+			};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	small_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+			{
+				this->reset_to_inline();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Constructs the container with the contents of the range */
+			template <class InputIt>
+			small_vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+			{
+				this->reset_to_inline();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Copy constructor */
+			small_vector(const small_vector& other) : _alloc(other._alloc)
+			{
+				this->reset_to_inline();
+				this->reserve(other.size());
+				this->_end = this->construct_from_start(this->_start, other._start, other._end);
+			};
+
+			/* Deconstructor */
+			~small_vector()
+			{
+				this->deallocate_vector();
+			};
+
+			/* Copy assignation operator */
+			small_vector&	operator=(const small_vector& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->assign(other.begin(), other.end());
+				return (*this);
+			};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const T& value)
+			{
+				this->clear();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->clear();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				return (*(this->_start + pos));
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (*(this->_start + pos));
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				return (*this->_start);
+			};
+
+			const_reference	front() const
+			{
+				return (*this->_start);
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				return (*(this->_end - 1));
+			};
+
+			const_reference	back() const
+			{
+				return (*(this->_end - 1));
+			};
+
+			/* Element access: Returns pointer to the underlying array serving as element storage */
+			pointer	data()
+			{
+				return (this->_start);
+			};
+
+			const_pointer	data() const
+			{
+				return (this->_start);
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				return (iterator(this->_start));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->_start));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				return (iterator(this->_end));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this->_end));
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->_start == this->_end);
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (static_cast<size_type>(this->_end - this->_start));
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return (std::min(this->_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max())));
+			};
+
+			/* Capacity: Increase the capacity of the vector (Allocation might be needed) to a value that's greator or equal to new_cap */
+			void	reserve(size_type new_cap)
+			{
+				if (this->check_max_size(new_cap) || new_cap <= this->capacity())
+					return ;
+				this->reallocate(new_cap);
+			};
+
+			/* Capacity: Returns the number of elements that the container has currently allocated space for */
+			size_type	capacity() const
+			{
+				return (static_cast<size_type>(this->_cap - this->_start));
+			};
+
+			/* Capacity: Returns the number of elements stored without a heap allocation */
+			static size_type	inline_capacity()
+			{
+				return (N);
+			};
+
+			/* Capacity: Checks if the elements are stored inside the object */
+			bool	is_inline() const
+			{
+				return (this->_start == this->inline_start());
+			};
+
+			/* Capacity: Moves the elements back into the inline buffer, or into a smaller heap buffer, if they fit */
+			void	shrink_to_fit()
+			{
+				if (this->size() < this->capacity() && this->is_inline() == false)
+					this->reallocate(this->size());
+			};
+
+			/* Modifiers: Erases all elements from the container */
+			void	clear()
+			{
+				this->destroy_from_start(this->_start);
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const size_type	index = pos - this->begin();
+				this->insert(pos, 1, value);
+				return (iterator(this->_start + index));
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				if (count == 0)
+					return ;
+				const value_type	copy = value;
+				const size_type		index = pos - this->begin();
+				if (static_cast<size_type>(this->_cap - this->_end) < count)
+					this->reallocate(this->get_expansion(count));
+				pointer			position = this->_start + index;
+				const size_type	post = this->_end - position;
+				pointer			temp = this->_end;
+				if (post > count)
+				{
+					this->_end = this->construct_from_start(this->_end, this->_end - count, this->_end);
+					std::copy_backward(position, temp - count, temp);
+					std::fill_n(position, count, copy);
+				}
+				else
+				{
+					this->_end = this->construct_with_val(this->_end, this->_end + count - post, copy);
+					this->_end = this->construct_from_start(this->_end, position, temp);
+					std::fill(position, temp, copy);
+				}
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	old_size = this->size();
+
+				for (; first != last; ++first)
+					this->push_back(*first);
+				std::rotate(this->_start + index, this->_start + old_size, this->_end);
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				return (this->erase(pos, pos + 1));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			iterator	erase(iterator first, iterator last)
+			{
+				if (first == last)
+					return (first);
+				pointer	end = std::copy(last.base(), this->_end, first.base());
+				this->destroy_from_start(end);
+				return (first);
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				if (this->_end == this->_cap)
+				{
+					const value_type	copy = value;
+					this->reallocate(this->get_expansion(1));
+					this->_alloc.construct(this->_end, copy);
+				}
+				else
+					this->_alloc.construct(this->_end, value);
+				this->_end++;
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->_end--;
+				this->_alloc.destroy(this->_end);
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				const size_type	len = this->size();
+				if (count > len)
+					this->insert(this->end(), count - len, value);
+				else if (count < len)
+					this->destroy_from_start(this->_start + count);
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other. Elements stored inline are swapped one by one */
+			void	swap(small_vector& other)
+			{
+				if (this == &other)
+					return ;
+				if (this->is_inline() == false && other.is_inline() == false)
+				{
+					std::swap(this->_start, other._start);
+					std::swap(this->_end, other._end);
+					std::swap(this->_cap, other._cap);
+					return ;
+				}
+				small_vector	temp(*this);
+				*this = other;
+				other = temp;
+			};
+
+		private:
+			/* Helper function: If size is larger than max size, throw std::length_error exception */
+			int	check_max_size(size_type size) const
+			{
+				if (size > this->max_size())
+					throw std::length_error("Length error");
+				return (0);
+			};
+
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: Returns the first element slot of the inline buffer */
+			pointer	inline_start() const
+			{
+				return (reinterpret_cast<pointer>(const_cast<char*>(this->_inline._bytes)));
+			};
+
+			/* Helper function: Points the container at its empty inline buffer */
+			void	reset_to_inline()
+			{
+				this->_start = this->inline_start();
+				this->_end = this->_start;
+				this->_cap = this->_start + N;
+			};
+
+			/* Helper function: Range constructor (Using src as value) */
+			template <class Iterator>
+			pointer	construct_from_start(pointer dst, Iterator start, Iterator end)
+			{
+				for (; start != end; start++, dst++)
+					this->_alloc.construct(dst, *start);
+				return (dst);
+			}
+
+			/* Helper function: Range constructor (Using val as value) */
+			pointer	construct_with_val(pointer dst, const_pointer end, const_reference val)
+			{
+				for (; dst != end; dst++)
+					this->_alloc.construct(dst, val);
+				return (dst);
+			};
+
+			/* Helper function: Destroys the elements and releases the heap buffer, if any */
+			void	deallocate_vector()
+			{
+				this->clear();
+				if (this->is_inline() == false)
+					this->_alloc.deallocate(this->_start, this->capacity());
+			};
+
+			/* Helper function: Destroys allocated memory from the start */
+			void	destroy_from_start(pointer start)
+			{
+				for (pointer cur = start; cur != this->_end; cur++)
+					this->_alloc.destroy(cur);
+				this->_end = start;
+			};
+
+			/* Helper function: Moves the elements into a buffer of new_cap elements, which is the inline one if they fit */
+			void	reallocate(size_type new_cap)
+			{
+				pointer	start = this->inline_start();
+				pointer	end;
+
+				if (new_cap <= N)
+					new_cap = N;
+				else
+					start = this->_alloc.allocate(new_cap);
+				if (start == this->_start)
+					return ;
+				try
+				{
+					end = this->construct_from_start(start, this->_start, this->_end);
+				}
+				catch (...)
+				{
+					if (start != this->inline_start())
+						this->_alloc.deallocate(start, new_cap);
+					throw ;
+				}
+				this->deallocate_vector();
+				this->_start = start;
+				this->_end = end;
+				this->_cap = start + new_cap;
+			};
+
+			/* Helper function: Returns the size after count expansions */
+			size_type	get_expansion(size_type count) const
+			{
+				const size_type	max = this->max_size();
+				const size_type	cap = this->capacity();
+				if (max - this->size() < count)
+					throw std::length_error("Length error");
+				if (cap >= max / 2)
+					return (max);
+				return (std::max(this->size() + count, cap * 2));
+			};
+
+			/* Inline storage, aligned for every fundamental type */
+			union	inline_storage
+			{
+				char		_bytes[N * sizeof(T)];
+				long double	_align_long_double;
+				void*		_align_pointer;
+				long		_align_long;
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			pointer			_start;
+			pointer			_end;
+			pointer			_cap;
+			inline_storage	_inline;
+	};
+
+	/* Lexicographically compares the values in the vector */
+	template <class T, std::size_t N, class Alloc>
+	bool	operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool	operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool	operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool	operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool	operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	bool	operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, std::size_t N, class Alloc>
+	void	swap(small_vector<T, N, Alloc>& lhs, small_vector<T, N, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,1063 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soa_vector.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:14 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/20 11:07:52 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SOA_VECTOR_HPP
+# define SOA_VECTOR_HPP
+
+# include <memory>
+# include <limits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "type_traits.hpp"
+# include "iterator.hpp"
+# include "utility.hpp"
+
+/**
+ * https://en.wikipedia.org/wiki/AoS_and_SoA
+ *
+ * Vector of ft::pair that keeps every member in its own contiguous array
+ * (structure of arrays) instead of interleaving them (array of structures):
+ *
+ *     ft::vector<ft::pair<K, V> >        K V K V K V ...
+ *     ft::soa_vector<ft::pair<K, V> >    K K K ...   V V V ...
+ *
+ * A scan over one member only pulls that member into the cache. The second
+ * member is split again when it is itself an ft::pair, so
+ * ft::pair<A, ft::pair<B, C> > stands in for a tuple of three columns.
+ * Elements are reached through proxy references holding one reference per
+ * column, and column<I>() returns the array of the I-th column
+ */
+namespace ft
+{
+	/* Proxy reference to one element, holding a reference to each of its columns */
+	template <class Head, class Tail, class Value>
+	struct	soa_reference
+	{
+		/* Member objects */
+		Head	first;
+		Tail	second;
+
+		/* Constructs with the references to each column */
+		soa_reference(Head head, Tail tail) : first(head), second(tail) {};
+
+		/* Converts a mutable reference into a const one */
+		template <class H, class T>
+		soa_reference(const soa_reference<H, T, Value>& other) : first(other.first), second(other.second) {}
+
+		/* Copies the referenced members into a value */
+		operator Value() const
+		{
+			return (Value(this->first, this->second));
+		};
+
+		/* Assigns to the referenced members, not to the references */
+		soa_reference&	operator=(const Value& value)
+		{
+			this->first = value.first;
+			this->second = value.second;
+			return (*this);
+		};
+
+		soa_reference&	operator=(const soa_reference& other)
+		{
+			this->first = other.first;
+			this->second = other.second;
+			return (*this);
+		};
+	};
+
+	/* Compares the referenced element with a value */
+	template <class Head, class Tail, class Value>
+	bool	operator==(const soa_reference<Head, Tail, Value>& lhs, const Value& rhs)
+	{
+		return (lhs.first == rhs.first && lhs.second == rhs.second);
+	}
+
+	template <class Head, class Tail, class Value>
+	bool	operator==(const Value& lhs, const soa_reference<Head, Tail, Value>& rhs)
+	{
+		return (rhs == lhs);
+	}
+
+	template <class Head, class Tail, class Value>
+	bool	operator!=(const soa_reference<Head, Tail, Value>& lhs, const Value& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Head, class Tail, class Value>
+	bool	operator!=(const Value& lhs, const soa_reference<Head, Tail, Value>& rhs)
+	{
+		return (!(rhs == lhs));
+	}
+
+	/* Lexicographically compares two elements like ft::pair does, where either one may be a proxy reference */
+	template <class Lhs, class Rhs>
+	bool	soa_less(const Lhs& lhs, const Rhs& rhs)
+	{
+		return (lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second));
+	}
+
+	template <class H1, class T1, class H2, class T2, class Value>
+	bool	operator<(const soa_reference<H1, T1, Value>& lhs, const soa_reference<H2, T2, Value>& rhs)
+	{
+		return (soa_less(lhs, rhs));
+	}
+
+	template <class Head, class Tail, class Value>
+	bool	operator<(const soa_reference<Head, Tail, Value>& lhs, const Value& rhs)
+	{
+		return (soa_less(lhs, rhs));
+	}
+
+	template <class Head, class Tail, class Value>
+	bool	operator<(const Value& lhs, const soa_reference<Head, Tail, Value>& rhs)
+	{
+		return (soa_less(lhs, rhs));
+	}
+
+	/* Swaps the referenced elements column by column, so std::sort and friends can reorder a soa_vector */
+	template <class Head, class Tail, class Value>
+	void	swap(soa_reference<Head, Tail, Value> lhs, soa_reference<Head, Tail, Value> rhs)
+	{
+		using std::swap;
+		swap(lhs.first, rhs.first);
+		swap(lhs.second, rhs.second);
+	}
+
+	/* One contiguous array of T, sized and owned by the soa_vector */
+	template <class T, class Allocator>
+	class soa_array
+	{
+		public:
+			/* Member types */
+			typedef T															value_type;
+			typedef typename Allocator::template rebind<T>::other				allocator_type;
+			typedef std::size_t													size_type;
+			typedef value_type&													reference;
+			typedef const value_type&											const_reference;
+			typedef typename allocator_type::pointer							pointer;
+			typedef typename allocator_type::const_pointer						const_pointer;
+
+			/* Constructs without storage */
+			explicit	soa_array(const Allocator& alloc) : _alloc(alloc), _data(NULL) {};
+
+			/* Returns a pointer to the first element */
+			pointer	data()
+			{
+				return (this->_data);
+			};
+
+			const_pointer	data() const
+			{
+				return (this->_data);
+			};
+
+			/* Returns the element at index i */
+			reference	ref(size_type i)
+			{
+				return (this->_data[i]);
+			};
+
+			const_reference	ref(size_type i) const
+			{
+				return (this->_data[i]);
+			};
+
+			/* Returns the largest number of elements the allocator can provide */
+			size_type	max_size() const
+			{
+				return (this->_alloc.max_size());
+			};
+
+			/* Allocates room for n elements */
+			void	allocate(size_type n)
+			{
+				this->_data = (n == 0) ? NULL : this->_alloc.allocate(n);
+			};
+
+			/* Releases the room for n elements */
+			void	deallocate(size_type n)
+			{
+				if (this->_data != NULL)
+					this->_alloc.deallocate(this->_data, n);
+				this->_data = NULL;
+			};
+
+			/* Copy constructs value at index i */
+			void	construct(size_type i, const_reference value)
+			{
+				this->_alloc.construct(this->_data + i, value);
+			};
+
+			/* Copy constructs the first count elements of other into the same indices */
+			void	construct_from(const soa_array& other, size_type count)
+			{
+				size_type	i = 0;
+
+				try
+				{
+					for (; i < count; i++)
+						this->_alloc.construct(this->_data + i, other._data[i]);
+				}
+				catch (...)
+				{
+					this->destroy(0, i);
+					throw ;
+				}
+			};
+
+			/* Destroys the elements in [first, last) */
+			void	destroy(size_type first, size_type last)
+			{
+				for (; first != last; first++)
+					this->_alloc.destroy(this->_data + first);
+			};
+
+			/* Assigns the element at src to the element at dst */
+			void	assign(size_type dst, size_type src)
+			{
+				this->_data[dst] = this->_data[src];
+			};
+
+			/* Swaps the elements at i and j */
+			void	swap_elements(size_type i, size_type j)
+			{
+				std::swap(this->_data[i], this->_data[j]);
+			};
+
+			/* Exchanges the storage with other */
+			void	swap(soa_array& other)
+			{
+				std::swap(this->_data, other._data);
+			};
+
+		private:
+			/* Member objects */
+			allocator_type	_alloc;
+			pointer			_data;
+	};
+
+	/* Column layout of T. Anything that is not an ft::pair is stored in a single column */
+	template <class T, class Allocator>
+	class soa_columns : public soa_array<T, Allocator>
+	{
+		public:
+			/* Member types */
+			typedef soa_array<T, Allocator>					head_columns;
+			typedef typename head_columns::reference		reference;
+			typedef typename head_columns::const_reference	const_reference;
+
+			/* Constructs without storage */
+			explicit	soa_columns(const Allocator& alloc) : head_columns(alloc) {};
+
+			/* Returns the array of the first column */
+			typename head_columns::pointer	head_data()
+			{
+				return (this->data());
+			};
+
+			typename head_columns::const_pointer	head_data() const
+			{
+				return (this->data());
+			};
+	};
+
+	/* Column layout of ft::pair: first gets its own column, second is laid out recursively */
+	template <class T1, class T2, class Allocator>
+	class soa_columns<pair<T1, T2>, Allocator>
+	{
+		public:
+			/* Member types */
+			typedef pair<T1, T2>															value_type;
+			typedef std::size_t																size_type;
+			typedef soa_array<T1, Allocator>												head_columns;
+			typedef soa_columns<T2, Allocator>												tail_columns;
+			typedef soa_reference<typename head_columns::reference, typename tail_columns::reference, value_type>				reference;
+			typedef soa_reference<typename head_columns::const_reference, typename tail_columns::const_reference, value_type>	const_reference;
+
+			/* Member objects */
+			head_columns	head;
+			tail_columns	tail;
+
+			/* Constructs without storage */
+			explicit	soa_columns(const Allocator& alloc) : head(alloc), tail(alloc) {};
+
+			/* Returns the array of the first column */
+			typename head_columns::pointer	head_data()
+			{
+				return (this->head.data());
+			};
+
+			typename head_columns::const_pointer	head_data() const
+			{
+				return (this->head.data());
+			};
+
+			/* Returns the element at index i */
+			reference	ref(size_type i)
+			{
+				return (reference(this->head.ref(i), this->tail.ref(i)));
+			};
+
+			const_reference	ref(size_type i) const
+			{
+				return (const_reference(this->head.ref(i), this->tail.ref(i)));
+			};
+
+			/* Returns the largest number of elements every column can hold */
+			size_type	max_size() const
+			{
+				return (std::min(this->head.max_size(), this->tail.max_size()));
+			};
+
+			/* Allocates room for n elements in every column */
+			void	allocate(size_type n)
+			{
+				this->head.allocate(n);
+				try
+				{
+					this->tail.allocate(n);
+				}
+				catch (...)
+				{
+					this->head.deallocate(n);
+					throw ;
+				}
+			};
+
+			/* Releases the room for n elements in every column */
+			void	deallocate(size_type n)
+			{
+				this->head.deallocate(n);
+				this->tail.deallocate(n);
+			};
+
+			/* Copy constructs value at index i */
+			void	construct(size_type i, const value_type& value)
+			{
+				this->head.construct(i, value.first);
+				try
+				{
+					this->tail.construct(i, value.second);
+				}
+				catch (...)
+				{
+					this->head.destroy(i, i + 1);
+					throw ;
+				}
+			};
+
+			/* Copy constructs the first count elements of other into the same indices */
+			void	construct_from(const soa_columns& other, size_type count)
+			{
+				this->head.construct_from(other.head, count);
+				try
+				{
+					this->tail.construct_from(other.tail, count);
+				}
+				catch (...)
+				{
+					this->head.destroy(0, count);
+					throw ;
+				}
+			};
+
+			/* Destroys the elements in [first, last) */
+			void	destroy(size_type first, size_type last)
+			{
+				this->head.destroy(first, last);
+				this->tail.destroy(first, last);
+			};
+
+			/* Assigns the element at src to the element at dst */
+			void	assign(size_type dst, size_type src)
+			{
+				this->head.assign(dst, src);
+				this->tail.assign(dst, src);
+			};
+
+			/* Swaps the elements at i and j */
+			void	swap_elements(size_type i, size_type j)
+			{
+				this->head.swap_elements(i, j);
+				this->tail.swap_elements(i, j);
+			};
+
+			/* Exchanges the storage with other */
+			void	swap(soa_columns& other)
+			{
+				this->head.swap(other.head);
+				this->tail.swap(other.tail);
+			};
+	};
+
+	/* Finds the I-th column of a layout */
+	template <class Columns, std::size_t I>
+	struct	soa_column
+	{
+		typedef soa_column<typename Columns::tail_columns, I - 1>	next;
+		typedef typename next::value_type							value_type;
+		typedef typename next::pointer								pointer;
+		typedef typename next::const_pointer						const_pointer;
+
+		static pointer	get(Columns& columns)
+		{
+			return (next::get(columns.tail));
+		};
+
+		static const_pointer	get(const Columns& columns)
+		{
+			return (next::get(columns.tail));
+		};
+	};
+
+	template <class Columns>
+	struct	soa_column<Columns, 0>
+	{
+		typedef typename Columns::head_columns::value_type		value_type;
+		typedef typename Columns::head_columns::pointer			pointer;
+		typedef typename Columns::head_columns::const_pointer	const_pointer;
+
+		static pointer	get(Columns& columns)
+		{
+			return (columns.head_data());
+		};
+
+		static const_pointer	get(const Columns& columns)
+		{
+			return (columns.head_data());
+		};
+	};
+
+	/* Pointer-like wrapper returned by operator->, since a proxy reference has no address of its own */
+	template <class Reference>
+	class soa_arrow
+	{
+		public:
+			explicit	soa_arrow(const Reference& ref) : _ref(ref) {};
+
+			const Reference*	operator->() const
+			{
+				return (&this->_ref);
+			};
+
+		private:
+			Reference	_ref;
+	};
+
+	/* Random access iterator over a soa_vector, made of the container and an index */
+	template <class Container, class Reference>
+	class soa_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::random_access_iterator_tag			iterator_category;
+			typedef typename Container::value_type			value_type;
+			typedef typename Container::difference_type		difference_type;
+			typedef typename Container::size_type			size_type;
+			typedef Reference								reference;
+			typedef soa_arrow<Reference>					pointer;
+
+			/* Orthodox canonical form */
+			soa_iterator() : _container(NULL), _index(0) {};
+			template <class C, class R> soa_iterator(const soa_iterator<C, R>& other) : _container(other.container()), _index(other.index()) {}
+			~soa_iterator() {};
+			soa_iterator&	operator=(const soa_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_container = other._container;
+				this->_index = other._index;
+				return (*this);
+			};
+
+			/* Constructs an iterator to element index of container */
+			soa_iterator(Container* container, size_type index) : _container(container), _index(index) {};
+
+			/* Returns the container and the index */
+			Container*	container() const
+			{
+				return (this->_container);
+			};
+
+			size_type	index() const
+			{
+				return (this->_index);
+			};
+
+			/* Accesses the pointed-to element */
+			reference	operator*() const
+			{
+				return ((*this->_container)[this->_index]);
+			};
+
+			pointer	operator->() const
+			{
+				return (pointer(**this));
+			};
+
+			/* Accesses an element by index */
+			reference	operator[](difference_type n) const
+			{
+				return ((*this->_container)[this->_index + n]);
+			};
+
+			/* Advances or decrements the iterator */
+			soa_iterator&	operator++()
+			{
+				this->_index++;
+				return (*this);
+			};
+
+			soa_iterator&	operator--()
+			{
+				this->_index--;
+				return (*this);
+			};
+
+			soa_iterator	operator++(int)
+			{
+				return (soa_iterator(this->_container, this->_index++));
+			};
+
+			soa_iterator	operator--(int)
+			{
+				return (soa_iterator(this->_container, this->_index--));
+			};
+
+			soa_iterator	operator+(difference_type n) const
+			{
+				return (soa_iterator(this->_container, this->_index + n));
+			};
+
+			soa_iterator	operator-(difference_type n) const
+			{
+				return (soa_iterator(this->_container, this->_index - n));
+			};
+
+			soa_iterator&	operator+=(difference_type n)
+			{
+				this->_index += n;
+				return (*this);
+			};
+
+			soa_iterator&	operator-=(difference_type n)
+			{
+				this->_index -= n;
+				return (*this);
+			};
+
+		private:
+			/* Member objects */
+			Container*	_container;
+			size_type	_index;
+	};
+
+	/* Compares the indices */
+	template <class C1, class R1, class C2, class R2>
+	bool	operator==(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() == rhs.index());
+	}
+
+	template <class C1, class R1, class C2, class R2>
+	bool	operator!=(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() != rhs.index());
+	}
+
+	template <class C1, class R1, class C2, class R2>
+	bool	operator<(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() < rhs.index());
+	}
+
+	template <class C1, class R1, class C2, class R2>
+	bool	operator<=(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() <= rhs.index());
+	}
+
+	template <class C1, class R1, class C2, class R2>
+	bool	operator>(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() > rhs.index());
+	}
+
+	template <class C1, class R1, class C2, class R2>
+	bool	operator>=(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (lhs.index() >= rhs.index());
+	}
+
+	/* Advances the iterator */
+	template <class C, class R>
+	soa_iterator<C, R>	operator+(typename soa_iterator<C, R>::difference_type n, const soa_iterator<C, R>& it)
+	{
+		return (it + n);
+	}
+
+	/* Computes the distance between two iterators */
+	template <class C1, class R1, class C2, class R2>
+	typename soa_iterator<C1, R1>::difference_type	operator-(const soa_iterator<C1, R1>& lhs, const soa_iterator<C2, R2>& rhs)
+	{
+		return (static_cast<typename soa_iterator<C1, R1>::difference_type>(lhs.index() - rhs.index()));
+	}
+
+	/* Soa_vector class */
+	template <class T, class Allocator = std::allocator<T> >
+	class soa_vector
+	{
+		private:
+			/* Helper types */
+			typedef soa_columns<T, Allocator>						columns_type;
+
+		public:
+			/* Member types */
+			typedef T												value_type;
+			typedef Allocator										allocator_type;
+			typedef std::size_t										size_type;
+			typedef std::ptrdiff_t									difference_type;
+			typedef typename columns_type::reference				reference;
+			typedef typename columns_type::const_reference			const_reference;
+			typedef soa_iterator<soa_vector, reference>				iterator;
+			typedef soa_iterator<const soa_vector, const_reference>	const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+			/* Default constructor */
+			soa_vector() : _alloc(allocator_type()), _columns(_alloc), _size(0), _cap(0) {};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	soa_vector(const allocator_type& alloc) : _alloc(alloc), _columns(alloc), _size(0), _cap(0) {};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	soa_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _columns(alloc), _size(0), _cap(0)
+			{
+				this->insert(this->end(), count, value);
+			};
+
+			/* Constructs the container with the contents of the range */
+			template <class InputIt>
+			soa_vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc), _columns(alloc), _size(0), _cap(0)
+			{
+				this->insert(this->end(), first, last);
+			}
+
+			/* Copy constructor */
+			soa_vector(const soa_vector& other) : _alloc(other._alloc), _columns(other._alloc), _size(0), _cap(0)
+			{
+				this->reserve(other._size);
+				this->_columns.construct_from(other._columns, other._size);
+				this->_size = other._size;
+			};
+
+			/* Destructor */
+			~soa_vector()
+			{
+				this->clear();
+				this->_columns.deallocate(this->_cap);
+			};
+
+			/* Copy assignation operator */
+			soa_vector&	operator=(const soa_vector& other)
+			{
+				if (this == &other)
+					return (*this);
+				soa_vector	temp(other);
+				this->swap(temp);
+				return (*this);
+			};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const value_type& value)
+			{
+				this->clear();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->clear();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_range(pos);
+				return (this->_columns.ref(pos));
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return (this->_columns.ref(pos));
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				return (this->_columns.ref(pos));
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (this->_columns.ref(pos));
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				return (this->_columns.ref(0));
+			};
+
+			const_reference	front() const
+			{
+				return (this->_columns.ref(0));
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				return (this->_columns.ref(this->_size - 1));
+			};
+
+			const_reference	back() const
+			{
+				return (this->_columns.ref(this->_size - 1));
+			};
+
+			/* Element access: Returns the contiguous array holding the I-th column (first is 0) */
+			template <std::size_t I>
+			typename soa_column<columns_type, I>::pointer	column()
+			{
+				return (soa_column<columns_type, I>::get(this->_columns));
+			}
+
+			template <std::size_t I>
+			typename soa_column<columns_type, I>::const_pointer	column() const
+			{
+				return (soa_column<columns_type, I>::get(this->_columns));
+			}
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				return (iterator(this, 0));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this, 0));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				return (iterator(this, this->_size));
+			};
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this, this->_size));
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->_size == 0);
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (this->_size);
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				return (std::min(this->_columns.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max())));
+			};
+
+			/* Capacity: Increase the capacity of every column to a value that's greater or equal to new_cap */
+			void	reserve(size_type new_cap)
+			{
+				if (new_cap > this->max_size())
+					throw std::length_error("Length error");
+				if (new_cap > this->_cap)
+					this->reallocate(new_cap);
+			};
+
+			/* Capacity: Returns the number of elements that the container has currently allocated space for */
+			size_type	capacity() const
+			{
+				return (this->_cap);
+			};
+
+			/* Modifiers: Erases all elements from the container */
+			void	clear()
+			{
+				this->_columns.destroy(0, this->_size);
+				this->_size = 0;
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const size_type	index = pos.index();
+				this->push_back(value);
+				this->rotate(index, this->_size - 1, this->_size);
+				return (iterator(this, index));
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				const size_type		index = pos.index();
+				const size_type		old_size = this->_size;
+				const value_type	copy = value;
+
+				if (this->_cap - this->_size < count)
+					this->reallocate(this->get_expansion(count));
+				for (size_type i = 0; i < count; i++)
+					this->push_back(copy);
+				this->rotate(index, old_size, this->_size);
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				const size_type	index = pos.index();
+				const size_type	old_size = this->_size;
+
+				for (; first != last; ++first)
+					this->push_back(*first);
+				this->rotate(index, old_size, this->_size);
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				return (this->erase(pos, pos + 1));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			iterator	erase(iterator first, iterator last)
+			{
+				const size_type	dst = first.index();
+				const size_type	count = last.index() - dst;
+
+				if (count == 0)
+					return (first);
+				for (size_type i = last.index(); i < this->_size; i++)
+					this->_columns.assign(i - count, i);
+				this->_columns.destroy(this->_size - count, this->_size);
+				this->_size -= count;
+				return (iterator(this, dst));
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				if (this->_size == this->_cap)
+				{
+					const value_type	copy = value;
+					this->reallocate(this->get_expansion(1));
+					this->_columns.construct(this->_size, copy);
+				}
+				else
+					this->_columns.construct(this->_size, value);
+				this->_size++;
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->_size--;
+				this->_columns.destroy(this->_size, this->_size + 1);
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				if (count > this->_size)
+					this->insert(this->end(), count - this->_size, value);
+				else if (count < this->_size)
+					this->erase(this->begin() + count, this->end());
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(soa_vector& other)
+			{
+				this->_columns.swap(other._columns);
+				std::swap(this->_size, other._size);
+				std::swap(this->_cap, other._cap);
+			};
+
+		private:
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: Returns the size after count expansions */
+			size_type	get_expansion(size_type count) const
+			{
+				const size_type	max = this->max_size();
+				if (max - this->_size < count)
+					throw std::length_error("Length error");
+				if (this->_cap >= max / 2)
+					return (max);
+				return (std::max(this->_size + count, this->_cap * 2));
+			};
+
+			/* Helper function: Copies every column into arrays of new_cap elements */
+			void	reallocate(size_type new_cap)
+			{
+				columns_type	columns(this->_alloc);
+
+				columns.allocate(new_cap);
+				try
+				{
+					columns.construct_from(this->_columns, this->_size);
+				}
+				catch (...)
+				{
+					columns.deallocate(new_cap);
+					throw ;
+				}
+				this->_columns.destroy(0, this->_size);
+				this->_columns.deallocate(this->_cap);
+				this->_columns.swap(columns);
+				this->_cap = new_cap;
+			};
+
+			/* Helper function: Reverses the elements in [first, last) */
+			void	reverse(size_type first, size_type last)
+			{
+				for (; first + 1 < last; first++, last--)
+					this->_columns.swap_elements(first, last - 1);
+			};
+
+			/* Helper function: Rotates [first, last) so that middle becomes the first element */
+			void	rotate(size_type first, size_type middle, size_type last)
+			{
+				if (first == middle || middle == last)
+					return ;
+				this->reverse(first, middle);
+				this->reverse(middle, last);
+				this->reverse(first, last);
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			columns_type	_columns;
+			size_type		_size;
+			size_type		_cap;
+	};
+
+	/* Lexicographically compares the values in the vector */
+	template <class T, class Alloc>
+	bool	operator==(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (std::size_t i = 0; i < lhs.size(); i++)
+			if (!(T(lhs[i]) == T(rhs[i])))
+				return (false);
+		return (true);
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator<(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		for (std::size_t i = 0; i < lhs.size(); i++)
+		{
+			if (i == rhs.size() || T(rhs[i]) < T(lhs[i]))
+				return (false);
+			if (T(lhs[i]) < T(rhs[i]))
+				return (true);
+		}
+		return (lhs.size() < rhs.size());
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const soa_vector<T, Alloc>& lhs, const soa_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	/* Swaps the contents of lhs and rhs */
+	template <class T, class Alloc>
+	void	swap(soa_vector<T, Alloc>& lhs, soa_vector<T, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spsc_ring.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:17 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 10:04:17 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPSC_RING_HPP
+# define SPSC_RING_HPP
+
+# include <memory>
+# include <algorithm>
+# include "atomic.hpp"
+
+/**
+ * https://www.1024cores.net/home/lock-free-algorithms/queues
+ * https://rigtorp.se/ringbuffer/
+ *
+ * Bounded wait-free queue for exactly one producer thread and one consumer
+ * thread. Head and tail are free-running counters masked into a power of two
+ * sized buffer. Each side keeps a private copy of the other side's counter and
+ * only re-reads the shared one when the copy says the ring is full (producer)
+ * or empty (consumer), so in steady state neither side touches the other's
+ * cache line
+ */
+namespace ft
+{
+	/* Spsc_ring class */
+	template <class T, std::size_t N, class Allocator = std::allocator<T> >
+	class spsc_ring
+	{
+		public:
+			/* Member types */
+			typedef T										value_type;
+			typedef Allocator								allocator_type;
+			typedef std::size_t								size_type;
+			typedef value_type&								reference;
+			typedef const value_type&						const_reference;
+			typedef typename allocator_type::pointer		pointer;
+
+		private:
+			/* The counters are masked, so the capacity must be a power of two */
+			typedef char	capacity_must_be_a_power_of_two[(N >= 2 && (N & (N - 1)) == 0) ? 1 : -1];
+
+		public:
+			/* Constructs an empty ring with the given allocator */
+			explicit	spsc_ring(const allocator_type& alloc = allocator_type()) : _alloc(alloc), _buffer(NULL), _head(0), _tail_cache(0), _tail(0), _head_cache(0)
+			{
+				this->_buffer = this->_alloc.allocate(N);
+			};
+
+			/* Destructor. Must not race with the producer or the consumer */
+			~spsc_ring()
+			{
+				for (size_type i = this->_head; i != this->_tail; i++)
+					this->_alloc.destroy(this->_buffer + (i & (N - 1)));
+				this->_alloc.deallocate(this->_buffer, N);
+			};
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Capacity: Checks if the ring has no elements at the time of the call */
+			bool	empty() const
+			{
+				return (this->size() == 0);
+			};
+
+			/* Capacity: Returns a snapshot of the number of elements */
+			size_type	size() const
+			{
+				const size_type	head = atomic_load(&this->_head, memory_order_acquire);
+				return (atomic_load(&this->_tail, memory_order_acquire) - head);
+			};
+
+			/* Capacity: Returns the maximum number of elements the ring can hold */
+			size_type	capacity() const
+			{
+				return (N);
+			};
+
+			/* Producer: Copies value into the ring. Returns false if the ring is full */
+			bool	try_push(const value_type& value)
+			{
+				const size_type	tail = this->_tail;
+
+				if (tail - this->_head_cache == N)
+				{
+					this->_head_cache = atomic_load(&this->_head, memory_order_acquire);
+					if (tail - this->_head_cache == N)
+						return (false);
+				}
+				this->_alloc.construct(this->_buffer + (tail & (N - 1)), value);
+				atomic_store(&this->_tail, tail + 1, memory_order_release);
+				return (true);
+			};
+
+			/* Producer: Copies as many elements of [first, last) as fit and publishes them at once. Returns the first element not pushed */
+			template <class InputIt>
+			InputIt	push_range(InputIt first, InputIt last)
+			{
+				const size_type	tail = this->_tail;
+				size_type		count = 0;
+				size_type		available;
+
+				this->_head_cache = atomic_load(&this->_head, memory_order_acquire);
+				available = N - (tail - this->_head_cache);
+				try
+				{
+					for (; first != last && count < available; ++first, ++count)
+						this->_alloc.construct(this->_buffer + ((tail + count) & (N - 1)), *first);
+				}
+				catch (...)
+				{
+					atomic_store(&this->_tail, tail + count, memory_order_release);
+					throw ;
+				}
+				atomic_store(&this->_tail, tail + count, memory_order_release);
+				return (first);
+			}
+
+			/* Consumer: Moves the oldest element into value. Returns false if the ring is empty */
+			bool	try_pop(value_type& value)
+			{
+				const size_type	head = this->_head;
+				pointer			slot = this->_buffer + (head & (N - 1));
+
+				if (head == this->_tail_cache)
+				{
+					this->_tail_cache = atomic_load(&this->_tail, memory_order_acquire);
+					if (head == this->_tail_cache)
+						return (false);
+				}
+				value = *slot;
+				this->_alloc.destroy(slot);
+				atomic_store(&this->_head, head + 1, memory_order_release);
+				return (true);
+			};
+
+			/* Consumer: Writes up to count of the oldest elements to out and releases their slots at once. Returns the number of elements */
+			template <class OutputIt>
+			size_type	pop_range(OutputIt out, size_type count)
+			{
+				const size_type	head = this->_head;
+				size_type		i = 0;
+
+				this->_tail_cache = atomic_load(&this->_tail, memory_order_acquire);
+				count = std::min(count, this->_tail_cache - head);
+				try
+				{
+					for (; i < count; i++, ++out)
+					{
+						pointer	slot = this->_buffer + ((head + i) & (N - 1));
+						*out = *slot;
+						this->_alloc.destroy(slot);
+					}
+				}
+				catch (...)
+				{
+					atomic_store(&this->_head, head + i, memory_order_release);
+					throw ;
+				}
+				atomic_store(&this->_head, head + count, memory_order_release);
+				return (count);
+			}
+
+		private:
+			/* Not copyable: the ring is shared by address between threads */
+			spsc_ring(const spsc_ring& other);
+			spsc_ring&	operator=(const spsc_ring& other);
+
+			/* Member objects. Consumer-owned and producer-owned counters sit on separate cache lines */
+			allocator_type	_alloc;
+			pointer			_buffer;
+			char			_pad0[cache_line_size];
+			size_type		_head;
+			size_type		_tail_cache;
+			char			_pad1[cache_line_size];
+			size_type		_tail;
+			size_type		_head_cache;
+			char			_pad2[cache_line_size];
+	};
+}
+
+#endif
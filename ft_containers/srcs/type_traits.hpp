@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/21 13:52:39 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/16 13:45:59 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/19 18:47:52 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,8 @@
  * https://en.cppreference.com/w/cpp/types/remove_cv
  * https://en.cppreference.com/w/cpp/types/is_integral
  * https://en.cppreference.com/w/cpp/types/is_same
+ * https://en.cppreference.com/w/cpp/types/is_trivially_copyable
+ * https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2020/p1144r5.html
  * https://stackoverflow.com/questions/43571962/how-is-stdis-integral-implemented
  * https://youtu.be/H-m23Vvzcug
  * https://youtu.be/W3pFxSBkeJ8
@@ -79,6 +81,26 @@ namespace ft
 	 */
 	template <class T, class U>	struct is_same : public false_type {};
 	template <class T>			struct is_same<T, T> : public true_type {};
+
+	/**
+	 * Checks whether T can be copied byte by byte, e.g. with std::memmove.
+	 * Uses the compiler intrinsic, which GCC and Clang provide in every
+	 * language mode
+	 */
+	template <class T> struct is_trivially_copyable : public bool_constant<__is_trivially_copyable(T)> {};
+
+	/**
+	 * Checks whether an object of type T can be moved to new storage with
+	 * std::memmove, after which the old bytes are dropped without running the
+	 * destructor. True for trivially copyable types. Specialise it for types
+	 * that own resources through pointers but never point into themselves:
+	 *
+	 *     namespace ft { template <> struct is_trivially_relocatable<handle> : public bool_constant<true> {}; }
+	 *
+	 * libstdc++'s std::string keeps a pointer to its own small buffer, so it
+	 * must not be specialised there
+	 */
+	template <class T> struct is_trivially_relocatable : public is_trivially_copyable<T> {};
 }
 
 #endif
@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/28 17:33:47 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/19 14:24:14 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/19 22:38:54 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,9 +15,14 @@
 
 /**
  * https://en.cppreference.com/w/cpp/utility/pair
+ * https://en.cppreference.com/w/cpp/container/flat_map/sorted_unique
  */
 namespace ft
 {
+	/* Tag for the constructors that take a range already sorted by the comparator and free of equivalent keys */
+	struct	sorted_unique_t {};
+	const sorted_unique_t	sorted_unique = sorted_unique_t();
+
 	/* Pair struct */
 	template <class T1, class T2>
 	struct	pair
@@ -6,7 +6,7 @@
 /*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/15 12:37:58 by schuah            #+#    #+#             */
-/*   Updated: 2022/12/23 21:19:42 by schuah           ###   ########.fr       */
+/*   Updated: 2026/10/20 10:41:05 by schuah           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,9 +14,11 @@
 # define VECTOR_HPP
 
 # include <memory>
+# include <cstring>
 # include <algorithm>
 # include "vector_iterator.hpp"
 # include "algorithm.hpp"
+# include "relocate.hpp"
 
 /**
  * https://en.cppreference.com/w/cpp/container/vector
@@ -64,7 +66,7 @@ namespace ft
 			template <class InputIt>
 			vector(InputIt first, typename std::enable_if<!std::is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc), _start(NULL),  _end(NULL), _cap(NULL)
 			{
-				this->range_init(first, last);
+				this->range_init(first, last, typename iterator_traits<InputIt>::iterator_category());
 			};
 
 			/* Copy constructor */
@@ -122,7 +124,7 @@ namespace ft
 			template <class InputIt>
 			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
 			{
-				this->range_assign(first, last);
+				this->range_assign(first, last, typename iterator_traits<InputIt>::iterator_category());
 			};
 
 			/* Returns the allocator associated with the container */
@@ -257,11 +259,8 @@ namespace ft
 					return ;
 				pointer	start = this->_alloc.allocate(new_cap);
 				pointer	end;
-				end = this->construct_from_start(start, this->_start, this->_end);
-				this->deallocate_vector();
-				this->_start = start;
-				this->_end = end;
-				this->_cap = this->_start + new_cap;
+				end = this->relocate(start, this->_start, this->_end);
+				this->replace_storage(start, end, new_cap);
 			};
 
 			/* Capacity: Returns the number of elements that the container has currently allocated space for */
@@ -312,13 +311,10 @@ namespace ft
 					const size_type	size = this->get_expansion(count);
 					pointer			start = this->_alloc.allocate(size);
 					pointer			end;
-					end = this->construct_from_start(start, this->_start, pos.base());
+					end = this->relocate(start, this->_start, pos.base());
 					end = this->construct_with_val(end, end + count, value);
-					end = this->construct_from_start(end, pos.base(), this->_end);
-					this->deallocate_vector();
-					this->_start = start;
-					this->_end = end;
-					this->_cap = start + size;
+					end = this->relocate(end, pos.base(), this->_end);
+					this->replace_storage(start, end, size);
 				}
 			};
 
@@ -326,31 +322,59 @@ namespace ft
 			template <class InputIt>
 			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
 			{
-				this->range_insert(pos, first, last);
+				this->range_insert(pos, first, last, typename iterator_traits<InputIt>::iterator_category());
 			};
 
 			/* Modifiers: Removes the element at pos */
 			iterator	erase(iterator pos)
 			{
-				if (pos + 1 != this->end())
-					std::copy(pos + 1, this->end(), pos);
-				this->_end--;
-				this->_alloc.destroy(this->_end);
-				return (pos);
+				return (this->erase(pos, pos + 1));
 			};
 
 			/* Modifiers: Removes the elements in the range [first, last) */
 			iterator	erase(iterator first, iterator last)
 			{
+				relocatable	tag;
 				if (first == last)
 					return (first);
-				if (last != this->end())
-					std::copy(last, this->end(), first);
-				pointer	end = first.base() + (this->end() - last);
-				this->destroy_from_start(end);
+				this->discard(first.base(), last.base(), tag);
+				this->truncate(this->shift_down(first.base(), last.base(), this->_end, tag), tag);
 				return (first);
 			};
 
+			/* Modifiers: Removes the elements at the ascending indices in [first, last), moving every survivor once */
+			template <class InputIt>
+			void	erase_indices(InputIt first, InputIt last)
+			{
+				relocatable	tag;
+				if (first == last)
+					return ;
+				pointer	dst = this->_start + *first;
+				pointer	src = dst;
+				for (; first != last; ++first)
+				{
+					pointer	hole = this->_start + *first;
+					if (hole < src)
+						continue ;
+					dst = this->shift_down(dst, src, hole, tag);
+					this->discard(hole, hole + 1, tag);
+					src = hole + 1;
+				}
+				dst = this->shift_down(dst, src, this->_end, tag);
+				this->truncate(dst, tag);
+			}
+
+			/* Modifiers: Removes the element at pos in O(1) by moving the last element into its place. The order of the elements is not kept */
+			iterator	unordered_erase(iterator pos)
+			{
+				relocatable	tag;
+				this->discard(pos.base(), pos.base() + 1, tag);
+				if (pos + 1 != this->end())
+					this->shift_down(pos.base(), this->_end - 1, this->_end, tag);
+				this->truncate(this->_end - 1, tag);
+				return (pos);
+			};
+
 			/* Modifiers: Appends the given element value to the end of the container */
 			void	push_back(const value_type& value)
 			{
@@ -389,6 +413,12 @@ namespace ft
 			};
 		
 		private:
+			/* Selects the bitwise paths of the relocation and erase helpers */
+			typedef bool_constant<is_trivially_relocatable<T>::value>	relocatable;
+
+			template <class U, class Alloc, class Predicate>
+			friend typename vector<U, Alloc>::size_type	erase_if(vector<U, Alloc>& c, Predicate pred);
+
 			/* Helper function: If size is larger than max size, throw std::length_error exception */
 			int	check_max_size(size_type size)
 			{
@@ -416,12 +446,65 @@ namespace ft
 
 			/* Helper function: Range constructor (Using val as value) */
 			pointer	construct_with_val(pointer dst, const_pointer end, const_reference val)
+			{
+				return (this->construct_with_val(dst, end, val, bool_constant<is_trivially_copyable<T>::value>()));
+			};
+
+			pointer	construct_with_val(pointer dst, const_pointer end, const_reference val, bool_constant<true>)
+			{
+				const size_type	count = end - dst;
+				if (should_stream(count * sizeof(value_type)) == false)
+					return (this->construct_with_val(dst, end, val, bool_constant<false>()));
+				stream_fill(dst, &val, sizeof(value_type), count);
+				return (dst + count);
+			};
+
+			pointer	construct_with_val(pointer dst, const_pointer end, const_reference val, bool_constant<false>)
 			{
 				for (; dst != end; dst++)
 					this->_alloc.construct(dst, val);
 				return (dst);
 			};
 
+			/* Helper function: Copies [first, last) into the uninitialised storage at dst while reallocating. Trivially relocatable elements are copied bitwise. The originals are released by replace_storage */
+			pointer	relocate(pointer dst, pointer first, pointer last)
+			{
+				return (this->relocate(dst, first, last, relocatable()));
+			};
+
+			pointer	relocate(pointer dst, pointer first, pointer last, bool_constant<true>)
+			{
+				if (first != last)
+					relocate_bytes(dst, first, (last - first) * sizeof(value_type));
+				return (dst + (last - first));
+			};
+
+			pointer	relocate(pointer dst, pointer first, pointer last, bool_constant<false>)
+			{
+				return (this->construct_from_start(dst, first, last));
+			};
+
+			/* Helper function: Releases the old buffer and adopts [start, start + cap) holding the relocated elements up to end */
+			void	replace_storage(pointer start, pointer end, size_type cap)
+			{
+				this->release_relocated(relocatable());
+				this->_start = start;
+				this->_end = end;
+				this->_cap = start + cap;
+			};
+
+			/* Helper function: Deallocates the old buffer without destroying elements that were relocated bitwise */
+			void	release_relocated(bool_constant<true>)
+			{
+				if (this->_start != NULL)
+					this->_alloc.deallocate(this->_start, this->capacity());
+			};
+
+			void	release_relocated(bool_constant<false>)
+			{
+				this->deallocate_vector();
+			};
+
 			/* Helper function: Clears and deallocates this vector */
 			void	deallocate_vector()
 			{
@@ -440,6 +523,39 @@ namespace ft
 				this->_end = start;
 			};
 
+			/* Helper function: Destroys [first, last) before trivially relocatable elements are moved over it. Other types are overwritten by assignment instead */
+			void	discard(pointer first, pointer last, bool_constant<true>)
+			{
+				for (; first != last; first++)
+					this->_alloc.destroy(first);
+			};
+
+			void	discard(pointer, pointer, bool_constant<false>) {};
+
+			/* Helper function: Moves [first, last) down to dst, bitwise for trivially relocatable types. Returns the end of the moved range */
+			pointer	shift_down(pointer dst, pointer first, pointer last, bool_constant<true>)
+			{
+				if (dst != first && first != last)
+					std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+				return (dst + (last - first));
+			};
+
+			pointer	shift_down(pointer dst, pointer first, pointer last, bool_constant<false>)
+			{
+				return (std::copy(first, last, dst));
+			};
+
+			/* Helper function: Ends the vector at pos. The bitwise leftovers of relocated elements are not destroyed */
+			void	truncate(pointer pos, bool_constant<true>)
+			{
+				this->_end = pos;
+			};
+
+			void	truncate(pointer pos, bool_constant<false>)
+			{
+				this->destroy_from_start(pos);
+			};
+
 			/* Helper function: Returns the size after count expansions */
 			size_type	get_expansion(size_type count) const
 			{
@@ -452,9 +568,22 @@ namespace ft
 				return (std::max(size() + count, cap * 2));
 			};
 
+			/* Helper function: Assigns a single-pass range [first, last) by overwriting the elements, then appending the rest */
+			template <class InputIt>
+			void	range_assign(InputIt first, InputIt last, std::input_iterator_tag)
+			{
+				pointer	cur = this->_start;
+				for (; first != last && cur != this->_end; ++first, ++cur)
+					*cur = *first;
+				if (first == last)
+					this->destroy_from_start(cur);
+				else
+					this->range_insert(this->end(), first, last, std::input_iterator_tag());
+			}
+
 			/* Helper function: Assigns range [first, last) by copying */
 			template <class ForwardIt>
-			void	range_assign(ForwardIt first, ForwardIt last)
+			void	range_assign(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
 			{
 				const size_type	n = std::distance(first, last);
 				if (n < this->size())
@@ -471,9 +600,17 @@ namespace ft
 				}
 			};
 
-			/* Helper function: Range initialising by creating a new container */
+			/* Helper function: Range initialising from a single-pass range, growing geometrically */
+			template <class InputIt>
+			void	range_init(InputIt first, InputIt last, std::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			/* Helper function: Range initialising by creating a new container with one exact allocation */
 			template <class ForwardIt>
-			void	range_init(ForwardIt first, ForwardIt last)
+			void	range_init(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
 			{
 				const size_type count = std::distance(first, last);
 				if (count == 0 || this->check_max_size(count))
@@ -483,9 +620,21 @@ namespace ft
 				this->_end = this->construct_from_start(this->_start, first, last);
 			};
 
+			/* Helper function: Inserts from a single-pass range [first, last) into pos by appending, then rotating the new elements into place */
+			template <class InputIt>
+			void	range_insert(iterator pos, InputIt first, InputIt last, std::input_iterator_tag)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	old_size = this->size();
+				for (; first != last; ++first)
+					this->push_back(*first);
+				if (index != old_size)
+					std::rotate(this->_start + index, this->_start + old_size, this->_end);
+			}
+
 			/* Helper function: Inserts from range [first, last) into pos by constructing*/
 			template <class ForwardIt>
-			void	range_insert(iterator pos, ForwardIt first, ForwardIt last)
+			void	range_insert(iterator pos, ForwardIt first, ForwardIt last, std::forward_iterator_tag)
 			{
 				if (first == last)
 					return ;
@@ -516,13 +665,10 @@ namespace ft
 					const size_type	size = this->get_expansion(count);
 					pointer			start = this->_alloc.allocate(size);
 					pointer			end = start;
-					end = this->construct_from_start(start, this->_start, pos.base());
+					end = this->relocate(start, this->_start, pos.base());
 					end = this->construct_from_start(end, first, last);
-					end = this->construct_from_start(end, pos.base(), this->_end);
-					this->deallocate_vector();
-					this->_start = start;
-					this->_end = end;
-					this->_cap = start + size;
+					end = this->relocate(end, pos.base(), this->_end);
+					this->replace_storage(start, end, size);
 				}
 			};
 
@@ -576,6 +722,66 @@ namespace ft
 	{
 		lhs.swap(rhs);
 	}
+
+	/**
+	 * Moves the elements of [first, last) that pred rejects to the front. Runs
+	 * of survivors of trivially relocatable types are moved with one memmove
+	 * each, after the matching elements are destroyed, so the bytes left past
+	 * the returned end must not be destroyed again. If pred throws, the
+	 * unscanned elements are moved down behind the survivors and last is set
+	 * to the new end before the exception goes on
+	 */
+	template <class T, class Alloc, class Predicate>
+	T*	compact_if(T* first, T*& last, Predicate& pred, Alloc& alloc, bool_constant<true>)
+	{
+		T*	dst = first;
+		T*	live = first;
+
+		try
+		{
+			while (first != last)
+			{
+				while (first != last && !pred(*first))
+					++first;
+				if (dst != live)
+					std::memmove(static_cast<void*>(dst), static_cast<const void*>(live), (first - live) * sizeof(T));
+				dst += first - live;
+				for (live = first; live != last && pred(*live); ++live)
+					alloc.destroy(live);
+				first = live;
+			}
+		}
+		catch (...)
+		{
+			if (dst != live)
+				std::memmove(static_cast<void*>(dst), static_cast<const void*>(live), (last - live) * sizeof(T));
+			last = dst + (last - live);
+			throw ;
+		}
+		return (dst);
+	}
+
+	template <class T, class Alloc, class Predicate>
+	T*	compact_if(T* first, T*& last, Predicate& pred, Alloc&, bool_constant<false>)
+	{
+		return (std::remove_if(first, last, pred));
+	}
+
+	/* Erases all elements that satisfy pred in a single pass. Returns the number of erased elements */
+	template <class T, class Alloc, class Predicate>
+	typename vector<T, Alloc>::size_type	erase_if(vector<T, Alloc>& c, Predicate pred)
+	{
+		const typename vector<T, Alloc>::size_type	size = c.size();
+
+		if (size == 0)
+			return (0);
+		typedef bool_constant<is_trivially_relocatable<T>::value>	relocatable;
+		T*	end = compact_if(&c[0], c._end, pred, c._alloc, relocatable());
+		c.truncate(end, relocatable());
+		return (size - c.size());
+	}
 }
 
+# include "vector_bool.hpp"
+
 #endif
@@ -0,0 +1,790 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: schuah <schuah@student.42kl.edu.my>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:47:05 by schuah            #+#    #+#             */
+/*   Updated: 2026/10/19 14:31:48 by schuah           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+# include <memory>
+# include <limits>
+# include <climits>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include "vector.hpp"
+
+/**
+ * https://en.cppreference.com/w/cpp/container/vector_bool
+ *
+ * Bit-packed specialization of ft::vector for bool. Flags are stored in
+ * words of unsigned long, so the vector takes one bit per element instead of
+ * one byte, and elements are accessed through proxy references. Every bit
+ * past size() is kept at zero, which lets count(), find_first(), find_next(),
+ * the bitwise operators and comparison work on whole words
+ */
+namespace ft
+{
+	/* Proxy reference to one bit of a word */
+	template <class Word>
+	class bit_reference
+	{
+		public:
+			/* Constructs a reference to the bits of word selected by mask */
+			bit_reference(Word* word, Word mask) : _word(word), _mask(mask) {};
+
+			/* Reads the bit */
+			operator bool() const
+			{
+				return ((*this->_word & this->_mask) != 0);
+			};
+
+			/* Returns the inverse of the bit */
+			bool	operator~() const
+			{
+				return ((*this->_word & this->_mask) == 0);
+			};
+
+			/* Sets or clears the bit */
+			bit_reference&	operator=(bool value)
+			{
+				if (value)
+					*this->_word |= this->_mask;
+				else
+					*this->_word &= ~this->_mask;
+				return (*this);
+			};
+
+			bit_reference&	operator=(const bit_reference& other)
+			{
+				return (*this = static_cast<bool>(other));
+			};
+
+			/* Inverts the bit */
+			void	flip()
+			{
+				*this->_word ^= this->_mask;
+			};
+
+		private:
+			/* Member objects */
+			Word*	_word;
+			Word	_mask;
+	};
+
+	/* Reads the bit at offset bit of word, as a proxy for mutable words and as a value for const ones */
+	template <class Word>
+	bit_reference<Word>	bit_deref(Word* word, unsigned int bit)
+	{
+		return (bit_reference<Word>(word, Word(1) << bit));
+	}
+
+	template <class Word>
+	bool	bit_deref(const Word* word, unsigned int bit)
+	{
+		return (((*word >> bit) & Word(1)) != 0);
+	}
+
+	/* Random access iterator over the bits of an array of words */
+	template <class Word, class Reference, class WordPointer>
+	class bit_iterator
+	{
+		public:
+			/* Member types */
+			typedef std::random_access_iterator_tag		iterator_category;
+			typedef bool								value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef Reference							reference;
+			typedef void								pointer;
+
+			/* Number of bits in a word */
+			static const unsigned int	bits_per_word = sizeof(Word) * CHAR_BIT;
+
+			/* Orthodox canonical form */
+			bit_iterator() : _word(NULL), _bit(0) {};
+			template <class R, class P> bit_iterator(const bit_iterator<Word, R, P>& other) : _word(other.word()), _bit(other.bit()) {}
+			~bit_iterator() {};
+			bit_iterator&	operator=(const bit_iterator& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_word = other._word;
+				this->_bit = other._bit;
+				return (*this);
+			};
+
+			/* Constructs an iterator to bit offset bit of word */
+			bit_iterator(WordPointer word, unsigned int bit) : _word(word), _bit(bit) {};
+
+			/* Returns the word and the bit offset within it */
+			WordPointer	word() const
+			{
+				return (this->_word);
+			};
+
+			unsigned int	bit() const
+			{
+				return (this->_bit);
+			};
+
+			/* Accesses the pointed-to bit */
+			reference	operator*() const
+			{
+				return (bit_deref(this->_word, this->_bit));
+			};
+
+			/* Accesses a bit by index */
+			reference	operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			};
+
+			/* Advances or decrements the iterator */
+			bit_iterator&	operator++()
+			{
+				if (++this->_bit == bits_per_word)
+				{
+					this->_bit = 0;
+					this->_word++;
+				}
+				return (*this);
+			};
+
+			bit_iterator&	operator--()
+			{
+				if (this->_bit-- == 0)
+				{
+					this->_bit = bits_per_word - 1;
+					this->_word--;
+				}
+				return (*this);
+			};
+
+			bit_iterator	operator++(int)
+			{
+				bit_iterator	temp = *this;
+				++*this;
+				return (temp);
+			};
+
+			bit_iterator	operator--(int)
+			{
+				bit_iterator	temp = *this;
+				--*this;
+				return (temp);
+			};
+
+			bit_iterator	operator+(difference_type n) const
+			{
+				bit_iterator	temp = *this;
+				return (temp += n);
+			};
+
+			bit_iterator	operator-(difference_type n) const
+			{
+				bit_iterator	temp = *this;
+				return (temp += -n);
+			};
+
+			bit_iterator&	operator+=(difference_type n)
+			{
+				const difference_type	bits = static_cast<difference_type>(bits_per_word);
+				difference_type			pos = static_cast<difference_type>(this->_bit) + n;
+				difference_type			words = pos / bits;
+
+				if (pos % bits < 0)
+					words--;
+				this->_word += words;
+				this->_bit = static_cast<unsigned int>(pos - words * bits);
+				return (*this);
+			};
+
+			bit_iterator&	operator-=(difference_type n)
+			{
+				return (*this += -n);
+			};
+
+		private:
+			/* Member objects */
+			WordPointer		_word;
+			unsigned int	_bit;
+	};
+
+	/* Compares the underlying positions */
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator==(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (lhs.word() == rhs.word() && lhs.bit() == rhs.bit());
+	}
+
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator!=(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator<(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (lhs - rhs < 0);
+	}
+
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator<=(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (lhs - rhs <= 0);
+	}
+
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator>(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (lhs - rhs > 0);
+	}
+
+	template <class W, class R1, class P1, class R2, class P2>
+	bool	operator>=(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return (lhs - rhs >= 0);
+	}
+
+	/* Advances the iterator */
+	template <class W, class R, class P>
+	bit_iterator<W, R, P>	operator+(typename bit_iterator<W, R, P>::difference_type n, const bit_iterator<W, R, P>& it)
+	{
+		return (it + n);
+	}
+
+	/* Computes the distance between two iterators */
+	template <class W, class R1, class P1, class R2, class P2>
+	std::ptrdiff_t	operator-(const bit_iterator<W, R1, P1>& lhs, const bit_iterator<W, R2, P2>& rhs)
+	{
+		return ((lhs.word() - rhs.word()) * static_cast<std::ptrdiff_t>(sizeof(W) * CHAR_BIT)
+			+ static_cast<std::ptrdiff_t>(lhs.bit()) - static_cast<std::ptrdiff_t>(rhs.bit()));
+	}
+
+	/* Vector<bool> class */
+	template <class Allocator>
+	class vector<bool, Allocator>
+	{
+		public:
+			/* Member types */
+			typedef bool																value_type;
+			typedef Allocator															allocator_type;
+			typedef std::size_t															size_type;
+			typedef std::ptrdiff_t														difference_type;
+			typedef unsigned long														word_type;
+			typedef bit_reference<word_type>											reference;
+			typedef bool																const_reference;
+			typedef bit_iterator<word_type, reference, word_type*>						iterator;
+			typedef bit_iterator<word_type, const_reference, const word_type*>			const_iterator;
+			typedef	ft::reverse_iterator<iterator>										reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>								const_reverse_iterator;
+
+			/* Number of bits in a word */
+			static const size_type	bits_per_word = sizeof(word_type) * CHAR_BIT;
+
+		private:
+			/* Helper types */
+			typedef typename allocator_type::template rebind<word_type>::other			word_allocator;
+			typedef typename word_allocator::pointer									word_pointer;
+
+		public:
+			/* Default constructor */
+			vector() : _alloc(allocator_type()), _word_alloc(_alloc), _words(NULL), _size(0), _cap(0) {};
+
+			/* Constructs an empty container with the given allocator */
+			explicit	vector(const allocator_type& alloc) : _alloc(alloc), _word_alloc(alloc), _words(NULL), _size(0), _cap(0) {};
+
+			/* Constructs the container with count copies of elements with value */
+			explicit	vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _word_alloc(alloc), _words(NULL), _size(0), _cap(0)
+			{
+				this->insert(this->end(), count, value);
+			};
+
+			/* Constructs the container with the contents of the range */
+			template <class InputIt>
+			vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last, const allocator_type& alloc = allocator_type()) : _alloc(alloc), _word_alloc(alloc), _words(NULL), _size(0), _cap(0)
+			{
+				this->insert(this->end(), first, last);
+			}
+
+			/* Copy constructor */
+			vector(const vector& other) : _alloc(other._alloc), _word_alloc(other._word_alloc), _words(NULL), _size(0), _cap(0)
+			{
+				this->reserve(other._size);
+				std::copy(other._words, other._words + word_count(other._size), this->_words);
+				this->_size = other._size;
+			};
+
+			/* Deconstructor */
+			~vector()
+			{
+				if (this->_words != NULL)
+					this->_word_alloc.deallocate(this->_words, this->_cap);
+			};
+
+			/* Copy assignation operator */
+			vector&	operator=(const vector& other)
+			{
+				if (this == &other)
+					return (*this);
+				vector	temp(other);
+				this->swap(temp);
+				return (*this);
+			};
+
+			/* Replaces the contents with count copies of value */
+			void	assign(size_type count, const value_type& value)
+			{
+				this->clear();
+				this->insert(this->end(), count, value);
+			};
+
+			/* Replaces the contents with copies of those in range [first, last) */
+			template <class InputIt>
+			void	assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				this->clear();
+				this->insert(this->end(), first, last);
+			}
+
+			/* Returns the allocator associated with the container */
+			allocator_type	get_allocator() const
+			{
+				return (this->_alloc);
+			};
+
+			/* Element access: Returns a reference to the element at specifies location pos, with bounds checking */
+			reference	at(size_type pos)
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			const_reference	at(size_type pos) const
+			{
+				this->check_range(pos);
+				return ((*this)[pos]);
+			};
+
+			/* Element access: Returns a reference to the element at specified location pos. No bounds checking is performed */
+			reference	operator[](size_type pos)
+			{
+				return (reference(this->_words + pos / bits_per_word, word_type(1) << (pos % bits_per_word)));
+			};
+
+			const_reference	operator[](size_type pos) const
+			{
+				return (((this->_words[pos / bits_per_word] >> (pos % bits_per_word)) & word_type(1)) != 0);
+			};
+
+			/* Element access: Returns a reference to the first element in the container */
+			reference	front()
+			{
+				return ((*this)[0]);
+			};
+
+			const_reference	front() const
+			{
+				return ((*this)[0]);
+			};
+
+			/* Element access: Returns a reference to the last element in the container */
+			reference	back()
+			{
+				return ((*this)[this->_size - 1]);
+			};
+
+			const_reference	back() const
+			{
+				return ((*this)[this->_size - 1]);
+			};
+
+			/* Element access: Returns pointer to the words holding the bits, least significant bit first */
+			word_type*	data()
+			{
+				return (this->_words);
+			};
+
+			const word_type*	data() const
+			{
+				return (this->_words);
+			};
+
+			/* Iterators: Returns an iterator to the first element of the vector */
+			iterator	begin()
+			{
+				return (iterator(this->_words, 0));
+			};
+
+			const_iterator	begin() const
+			{
+				return (const_iterator(this->_words, 0));
+			};
+
+			/* Iterators: Returns an iterator to the element following the last element of the vector */
+			iterator	end()
+			{
+				return (this->begin() + this->_size);
+			};
+
+			const_iterator	end() const
+			{
+				return (this->begin() + this->_size);
+			};
+
+			/* Iterators: Returns a reverse iterator to the first element of the reversed vector */
+			reverse_iterator	rbegin()
+			{
+				return (reverse_iterator(this->end()));
+			};
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			};
+
+			/* Iterators: Returns a reverse iterator to the element following the last element of the reversed vector */
+			reverse_iterator	rend()
+			{
+				return (reverse_iterator(this->begin()));
+			};
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			};
+
+			/* Capacity: Checks if the container has no elements */
+			bool	empty() const
+			{
+				return (this->_size == 0);
+			};
+
+			/* Capacity: Returns the number of elements in the container */
+			size_type	size() const
+			{
+				return (this->_size);
+			};
+
+			/* Capacity: Returns the maximum number of elements the container is able to hold due to system or library implementation limitations */
+			size_type	max_size() const
+			{
+				const size_type	words = std::min(this->_word_alloc.max_size(), static_cast<size_type>(std::numeric_limits<difference_type>::max()) / bits_per_word);
+				return (words * bits_per_word);
+			};
+
+			/* Capacity: Increase the capacity of the vector (Allocation might be needed) to a value that's greator or equal to new_cap */
+			void	reserve(size_type new_cap)
+			{
+				if (new_cap > this->max_size())
+					throw std::length_error("Length error");
+				if (new_cap > this->capacity())
+					this->reallocate(word_count(new_cap));
+			};
+
+			/* Capacity: Returns the number of elements that the container has currently allocated space for */
+			size_type	capacity() const
+			{
+				return (this->_cap * bits_per_word);
+			};
+
+			/* Modifiers: Erases all elements from the container */
+			void	clear()
+			{
+				std::fill(this->_words, this->_words + word_count(this->_size), word_type(0));
+				this->_size = 0;
+			};
+
+			/* Modifiers: Insert value before pos */
+			iterator	insert(iterator pos, const value_type& value)
+			{
+				const size_type	index = pos - this->begin();
+				this->insert(pos, 1, value);
+				return (this->begin() + index);
+			};
+
+			/* Modifiers: Inserts count copies of the value before pos */
+			void	insert(iterator pos, size_type count, const value_type& value)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	old_size = this->_size;
+
+				if (count == 0)
+					return ;
+				this->grow(count);
+				std::copy_backward(this->begin() + index, this->begin() + old_size, this->end());
+				std::fill(this->begin() + index, this->begin() + (index + count), value);
+			};
+
+			/* Modifiers: Insert elements from range [first, last) before pos */
+			template <class InputIt>
+			void	insert(iterator pos, InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+			{
+				const size_type	index = pos - this->begin();
+				const size_type	old_size = this->_size;
+
+				if (index == old_size)
+				{
+					for (; first != last; ++first)
+						this->push_back(*first);
+					return ;
+				}
+				const vector	bits(first, last, this->_alloc);
+				this->grow(bits._size);
+				std::copy_backward(this->begin() + index, this->begin() + old_size, this->end());
+				std::copy(bits.begin(), bits.end(), this->begin() + index);
+			}
+
+			/* Modifiers: Removes the element at pos */
+			iterator	erase(iterator pos)
+			{
+				return (this->erase(pos, pos + 1));
+			};
+
+			/* Modifiers: Removes the elements in the range [first, last) */
+			iterator	erase(iterator first, iterator last)
+			{
+				const size_type	index = first - this->begin();
+
+				if (first == last)
+					return (first);
+				this->shrink(std::copy(last, this->end(), first) - this->begin());
+				return (this->begin() + index);
+			};
+
+			/* Modifiers: Appends the given element value to the end of the container */
+			void	push_back(const value_type& value)
+			{
+				if (this->_size == this->capacity())
+					this->reallocate(word_count(this->get_expansion(1)));
+				if (value)
+					this->_words[this->_size / bits_per_word] |= word_type(1) << (this->_size % bits_per_word);
+				this->_size++;
+			};
+
+			/* Modifiers: Removes the last element of the element */
+			void	pop_back()
+			{
+				this->shrink(this->_size - 1);
+			};
+
+			/* Modifiers: Resizes the container to contain count element */
+			void	resize(size_type count, value_type value = value_type())
+			{
+				if (count > this->_size)
+					this->insert(this->end(), count - this->_size, value);
+				else
+					this->shrink(count);
+			};
+
+			/* Modifiers: Exchanges the contents of the container with those of other */
+			void	swap(vector& other)
+			{
+				std::swap(this->_words, other._words);
+				std::swap(this->_size, other._size);
+				std::swap(this->_cap, other._cap);
+			};
+
+			/* Modifiers: Exchanges the bits referred to by x and y */
+			static void	swap(reference x, reference y)
+			{
+				const bool	temp = x;
+				x = y;
+				y = temp;
+			};
+
+			/* Modifiers: Inverts every bit */
+			void	flip()
+			{
+				const size_type	words = word_count(this->_size);
+
+				for (size_type i = 0; i < words; i++)
+					this->_words[i] = ~this->_words[i];
+				this->clear_tail();
+			};
+
+			/* Bit operations: Returns the number of set bits */
+			size_type	count() const
+			{
+				const size_type	words = word_count(this->_size);
+				size_type		total = 0;
+
+				for (size_type i = 0; i < words; i++)
+					total += __builtin_popcountl(this->_words[i]);
+				return (total);
+			};
+
+			/* Bit operations: Returns the index of the first set bit, or size() if there is none */
+			size_type	find_first() const
+			{
+				return (this->find_from(0));
+			};
+
+			/* Bit operations: Returns the index of the first set bit after pos, or size() if there is none */
+			size_type	find_next(size_type pos) const
+			{
+				if (pos + 1 >= this->_size)
+					return (this->_size);
+				return (this->find_from(pos + 1));
+			};
+
+			/* Bit operations: Combines the bits with those of other, which must have the same size */
+			vector&	operator&=(const vector& other)
+			{
+				const size_type	words = this->check_same_size(other);
+
+				for (size_type i = 0; i < words; i++)
+					this->_words[i] &= other._words[i];
+				return (*this);
+			};
+
+			vector&	operator|=(const vector& other)
+			{
+				const size_type	words = this->check_same_size(other);
+
+				for (size_type i = 0; i < words; i++)
+					this->_words[i] |= other._words[i];
+				return (*this);
+			};
+
+			vector&	operator^=(const vector& other)
+			{
+				const size_type	words = this->check_same_size(other);
+
+				for (size_type i = 0; i < words; i++)
+					this->_words[i] ^= other._words[i];
+				return (*this);
+			};
+
+		private:
+			/* Helper function: Returns the number of words holding count bits */
+			static size_type	word_count(size_type count)
+			{
+				return ((count + bits_per_word - 1) / bits_per_word);
+			};
+
+			/* Helper function: If n is larger than size, throw std::out_of_range exception */
+			int	check_range(size_type n) const
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("Out of range");
+				return (0);
+			};
+
+			/* Helper function: If other has a different size, throw std::invalid_argument exception. Returns the number of words in use */
+			size_type	check_same_size(const vector& other) const
+			{
+				if (this->_size != other._size)
+					throw std::invalid_argument("Size mismatch");
+				return (word_count(this->_size));
+			};
+
+			/* Helper function: Returns the size after count expansions */
+			size_type	get_expansion(size_type count) const
+			{
+				const size_type	max = this->max_size();
+				const size_type	cap = this->capacity();
+				if (max - this->_size < count)
+					throw std::length_error("Length error");
+				if (cap >= max / 2)
+					return (max);
+				return (std::max(this->_size + count, cap * 2));
+			};
+
+			/* Helper function: Moves the words into a zeroed buffer of words words */
+			void	reallocate(size_type words)
+			{
+				word_pointer	start = this->_word_alloc.allocate(words);
+				const size_type	used = word_count(this->_size);
+
+				std::copy(this->_words, this->_words + used, start);
+				std::fill(start + used, start + words, word_type(0));
+				if (this->_words != NULL)
+					this->_word_alloc.deallocate(this->_words, this->_cap);
+				this->_words = start;
+				this->_cap = words;
+			};
+
+			/* Helper function: Appends count cleared bits */
+			void	grow(size_type count)
+			{
+				if (this->capacity() - this->_size < count)
+					this->reallocate(word_count(this->get_expansion(count)));
+				this->_size += count;
+			};
+
+			/* Helper function: Drops the bits from count onwards */
+			void	shrink(size_type count)
+			{
+				const size_type	used = word_count(this->_size);
+
+				this->_size = count;
+				std::fill(this->_words + word_count(count), this->_words + used, word_type(0));
+				this->clear_tail();
+			};
+
+			/* Helper function: Clears the bits past size() in the last word in use */
+			void	clear_tail()
+			{
+				const size_type	bits = this->_size % bits_per_word;
+
+				if (bits != 0)
+					this->_words[this->_size / bits_per_word] &= (word_type(1) << bits) - 1;
+			};
+
+			/* Helper function: Returns the index of the first set bit at or after pos, or size() if there is none */
+			size_type	find_from(size_type pos) const
+			{
+				const size_type	words = word_count(this->_size);
+				size_type		i = pos / bits_per_word;
+				word_type		word;
+
+				if (pos >= this->_size)
+					return (this->_size);
+				word = this->_words[i] & (~word_type(0) << (pos % bits_per_word));
+				while (word == 0)
+				{
+					if (++i == words)
+						return (this->_size);
+					word = this->_words[i];
+				}
+				return (i * bits_per_word + __builtin_ctzl(word));
+			};
+
+			/* Private member variables */
+			allocator_type	_alloc;
+			word_allocator	_word_alloc;
+			word_pointer	_words;
+			size_type		_size;
+			size_type		_cap;
+	};
+
+	/* Compares the words in use, since the bits past size() are always cleared */
+	template <class Alloc>
+	bool	operator==(const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs)
+	{
+		const std::size_t	bits = vector<bool, Alloc>::bits_per_word;
+
+		return (lhs.size() == rhs.size() && ft::equal(lhs.data(), lhs.data() + (lhs.size() + bits - 1) / bits, rhs.data()));
+	}
+
+	/* Erases all elements that satisfy pred in a single pass. Returns the number of erased elements */
+	template <class Alloc, class Predicate>
+	typename vector<bool, Alloc>::size_type	erase_if(vector<bool, Alloc>& c, Predicate pred)
+	{
+		const typename vector<bool, Alloc>::size_type	size = c.size();
+
+		c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+		return (size - c.size());
+	}
+}
+
+#endif